@@ -88,7 +88,7 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
    fm.length = size;
    fm.mmap_p = 0;
 
-   urls = get_urls_html_fm("xxx", &fm, "https://x.y", NULL, NULL);
+   urls = get_urls_html_fm("xxx", &fm, "https://x.y", NULL, NULL, NULL);
 	free_urlpos(urls);
 
 	RESTORE_STDERR
@@ -53,7 +53,14 @@ as that of the covered work.  */
 
 #include <errno.h>
 #include <string.h>
+#include <fcntl.h>
 #include <sys/time.h>
+#ifdef HAVE_SYS_IOCTL_H
+# include <sys/ioctl.h>
+#endif
+#ifdef HAVE_SYS_EPOLL_H
+# include <sys/epoll.h>
+#endif
 
 #include "utils.h"
 #include "host.h"
@@ -252,6 +259,68 @@ connect_with_timeout (int fd, const struct sockaddr *addr, socklen_t addrlen,
   return ctx.result;
 }
 
+/* Create a TCP socket of the family of SA, set it up as requested by
+   the options, and bind it to the requested local address, if any.
+   Returns the socket, or -1 with errno set.  */
+
+static int
+create_socket (const struct sockaddr *sa)
+{
+  int sock = socket (sa->sa_family, SOCK_STREAM, 0);
+  if (sock < 0)
+    return -1;
+
+#if defined(ENABLE_IPV6) && defined(IPV6_V6ONLY)
+  if (opt.ipv6_only) {
+    int on = 1;
+    /* In case of error, we will go on anyway... */
+    int err = setsockopt (sock, IPPROTO_IPV6, IPV6_V6ONLY, &on, sizeof (on));
+    IF_DEBUG
+      if (err < 0)
+        DEBUGP (("Failed setting IPV6_V6ONLY: %s", strerror (errno)));
+  }
+#endif
+
+  /* For very small rate limits, set the buffer size (and hence,
+     hopefully, the kernel's TCP window size) to the per-second limit.
+     That way we should never have to sleep for more than 1s between
+     network reads.  */
+  if (opt.limit_rate && opt.limit_rate < 8192)
+    {
+      int bufsize = opt.limit_rate;
+      if (bufsize < 512)
+        bufsize = 512;          /* avoid pathologically small values */
+#ifdef SO_RCVBUF
+      if (setsockopt (sock, SOL_SOCKET, SO_RCVBUF,
+                  (void *) &bufsize, (socklen_t) sizeof (bufsize)))
+        logprintf (LOG_NOTQUIET, _("setsockopt SO_RCVBUF failed: %s\n"),
+                   strerror (errno));
+#endif
+      /* When we add limit_rate support for writing, which is useful
+         for POST, we should also set SO_SNDBUF here.  */
+    }
+
+  if (opt.bind_address)
+    {
+      /* Bind the client side of the socket to the requested
+         address.  */
+      struct sockaddr_storage bind_ss;
+      struct sockaddr *bind_sa = (struct sockaddr *)&bind_ss;
+      if (resolve_bind_address (bind_sa))
+        {
+          if (bind (sock, bind_sa, sockaddr_size (bind_sa)) < 0)
+            {
+              int save_errno = errno;
+              fd_close (sock);
+              errno = save_errno;
+              return -1;
+            }
+        }
+    }
+
+  return sock;
+}
+
 /* Connect via TCP to the specified address and port.
 
    If PRINT is non-NULL, it is the host name to print that we're
@@ -299,53 +368,10 @@ connect_to_ip (const ip_address *ip, int port, const char *print)
   sockaddr_set_data (sa, ip, port);
 
   /* Create the socket of the family appropriate for the address.  */
-  sock = socket (sa->sa_family, SOCK_STREAM, 0);
+  sock = create_socket (sa);
   if (sock < 0)
     goto err;
 
-#if defined(ENABLE_IPV6) && defined(IPV6_V6ONLY)
-  if (opt.ipv6_only) {
-    int on = 1;
-    /* In case of error, we will go on anyway... */
-    int err = setsockopt (sock, IPPROTO_IPV6, IPV6_V6ONLY, &on, sizeof (on));
-    IF_DEBUG
-      if (err < 0)
-        DEBUGP (("Failed setting IPV6_V6ONLY: %s", strerror (errno)));
-  }
-#endif
-
-  /* For very small rate limits, set the buffer size (and hence,
-     hopefully, the kernel's TCP window size) to the per-second limit.
-     That way we should never have to sleep for more than 1s between
-     network reads.  */
-  if (opt.limit_rate && opt.limit_rate < 8192)
-    {
-      int bufsize = opt.limit_rate;
-      if (bufsize < 512)
-        bufsize = 512;          /* avoid pathologically small values */
-#ifdef SO_RCVBUF
-      if (setsockopt (sock, SOL_SOCKET, SO_RCVBUF,
-                  (void *) &bufsize, (socklen_t) sizeof (bufsize)))
-        logprintf (LOG_NOTQUIET, _("setsockopt SO_RCVBUF failed: %s\n"),
-                   strerror (errno));
-#endif
-      /* When we add limit_rate support for writing, which is useful
-         for POST, we should also set SO_SNDBUF here.  */
-    }
-
-  if (opt.bind_address)
-    {
-      /* Bind the client side of the socket to the requested
-         address.  */
-      struct sockaddr_storage bind_ss;
-      struct sockaddr *bind_sa = (struct sockaddr *)&bind_ss;
-      if (resolve_bind_address (bind_sa))
-        {
-          if (bind (sock, bind_sa, sockaddr_size (bind_sa)) < 0)
-            goto err;
-        }
-    }
-
   /* Connect the socket to the remote endpoint.  */
   if (connect_with_timeout (sock, sa, sockaddr_size (sa),
                             opt.connect_timeout) < 0)
@@ -379,6 +405,59 @@ connect_to_ip (const ip_address *ip, int port, const char *print)
   }
 }
 
+/* Start connecting via TCP to IP and PORT, without waiting for the
+   connection to be established.  The returned socket is non-blocking.
+   It becomes ready for writing once the attempt is over, after which
+   connect_finish tells whether it succeeded.  Returns -1 if the
+   attempt failed right away.  */
+
+int
+connect_to_ip_start (const ip_address *ip, int port)
+{
+  struct sockaddr_storage ss;
+  struct sockaddr *sa = (struct sockaddr *)&ss;
+  int sock;
+
+  sockaddr_set_data (sa, ip, port);
+  sock = create_socket (sa);
+  if (sock < 0)
+    return -1;
+
+  if (!fd_set_nonblocking (sock, true)
+      || (connect (sock, sa, sockaddr_size (sa)) < 0
+          && errno != EINPROGRESS && errno != EINTR))
+    {
+      int save_errno = errno;
+      fd_close (sock);
+      errno = save_errno;
+      return -1;
+    }
+
+  DEBUGP (("Connecting socket %d to %s:%d in the background.\n",
+           sock, print_address (ip), port));
+  return sock;
+}
+
+/* Return 0 if the connection started by connect_to_ip_start on FD has
+   been established, or -1 with errno set to the reason it failed.
+   This should be called once FD has become ready for writing.  */
+
+int
+connect_finish (int fd)
+{
+  int err = 0;
+  socklen_t errlen = sizeof (err);
+
+  if (getsockopt (fd, SOL_SOCKET, SO_ERROR, (void *) &err, &errlen) < 0)
+    return -1;
+  if (err)
+    {
+      errno = err;
+      return -1;
+    }
+  return 0;
+}
+
 /* Connect via TCP to a remote host on the specified port.
 
    HOST is resolved as an Internet host name.  If HOST resolves to
@@ -884,6 +963,16 @@ fd_transport_context (int fd)
   return info ? info->ctx : NULL;
 }
 
+/* Return true if a transport layer, such as SSL, has been registered
+   for FD with fd_register_transport.  */
+
+bool
+fd_transport_registered (int fd)
+{
+  return transport_map
+    && hash_table_contains (transport_map, (void *)(intptr_t) fd);
+}
+
 /* When fd_read/fd_write are called multiple times in a loop, they should
    remember the INFO pointer instead of fetching it every time.  It is
    not enough to compare FD to LAST_FD because FD might have been
@@ -1008,6 +1097,129 @@ fd_write (int fd, char *buf, int bufsize, double timeout)
   return res;
 }
 
+#ifdef HAVE_SPLICE
+/* The pipe fd_splice moves data through, and the process that created
+   it.  A forked child must not share the pipe with its parent, so it
+   creates its own.  */
+static int splice_pipe[2] = { -1, -1 };
+static pid_t splice_pipe_pid;
+
+static void
+splice_pipe_close (void)
+{
+  if (splice_pipe[0] >= 0 && splice_pipe_pid == getpid ())
+    {
+      close (splice_pipe[0]);
+      close (splice_pipe[1]);
+    }
+  splice_pipe[0] = splice_pipe[1] = -1;
+}
+
+/* Return true if the data arriving on FD can be moved with fd_splice,
+   i.e. if FD is a plain socket rather than one wrapped by a transport
+   such as TLS, whose data only exists decoded in user space.  */
+
+bool
+fd_splice_p (int fd)
+{
+  if (transport_map && hash_table_contains (transport_map, (void *)(intptr_t) fd))
+    return false;
+  if (splice_pipe[0] >= 0 && splice_pipe_pid != getpid ())
+    splice_pipe_close ();
+  if (splice_pipe[0] < 0)
+    {
+      if (pipe (splice_pipe) < 0)
+        {
+          splice_pipe[0] = splice_pipe[1] = -1;
+          return false;
+        }
+      splice_pipe_pid = getpid ();
+    }
+  return true;
+}
+
+/* Move the COUNT bytes sitting in the splice pipe to OUT with read
+   and write.  Return false if writing to OUT failed.  */
+
+static bool
+splice_drain (int out, ssize_t count)
+{
+  char buf[4096];
+  bool ok = true;
+
+  while (count > 0)
+    {
+      ssize_t res = read (splice_pipe[0], buf, MIN (count, (ssize_t) sizeof buf));
+      ssize_t written = 0;
+
+      if (res < 0 && errno == EINTR)
+        continue;
+      if (res <= 0)
+        {
+          /* The pipe no longer holds what it should; start afresh. */
+          splice_pipe_close ();
+          return false;
+        }
+      count -= res;
+      while (ok && written < res)
+        {
+          ssize_t w = write (out, buf + written, res - written);
+          if (w < 0 && errno == EINTR)
+            continue;
+          if (w <= 0)
+            ok = false;
+          else
+            written += w;
+        }
+    }
+  return ok;
+}
+
+/* Like fd_read, but instead of storing the data read from FD to a
+   buffer, move it to the file descriptor OUT without copying it to
+   user space.  fd_splice_p must have returned true for FD.
+
+   Return the number of bytes moved, 0 on EOF, or -1 on read error.
+   If writing to OUT failed, -2 is returned.  If the kernel can't
+   splice from FD, -3 is returned and nothing is read, so the caller
+   can fall back to fd_read.  */
+
+int
+fd_splice (int fd, int out, int bufsize, double timeout)
+{
+  ssize_t res, moved;
+
+  if (!poll_internal (fd, NULL, WAIT_FOR_READ, timeout))
+    return -1;
+
+  do
+    res = splice (fd, NULL, splice_pipe[1], NULL, bufsize,
+                  SPLICE_F_MOVE | SPLICE_F_MORE);
+  while (res == -1 && errno == EINTR);
+  if (res < 0)
+    return (errno == EINVAL || errno == ENOSYS) ? -3 : -1;
+
+  for (moved = 0; moved < res; )
+    {
+      ssize_t n = splice (splice_pipe[0], NULL, out, NULL, res - moved,
+                          SPLICE_F_MOVE | SPLICE_F_MORE);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        {
+          /* OUT doesn't support splicing after all, or writing to it
+             failed; write the rest in the ordinary way, which also
+             reports the error, if any.  */
+          if (!splice_drain (out, res - moved))
+            return -2;
+          break;
+        }
+      moved += n;
+    }
+  return res;
+}
+#endif /* HAVE_SPLICE */
+
 /* Report the most recent error(s) on FD.  This should only be called
    after fd_* functions, such as fd_read and fd_write, and only if
    they return a negative result.  For errors coming from other calls
@@ -1066,6 +1278,380 @@ fd_close (int fd)
     }
 }
 
+/* Like fd_close, but don't give the transport a chance to shut down
+   the connection, e.g. by sending an SSL close notification.  This is
+   used when another process still uses the same connection.  */
+
+void
+fd_abandon (int fd)
+{
+  struct transport_info *info;
+  if (fd < 0)
+    return;
+
+  info = NULL;
+  if (transport_map)
+    info = hash_table_get (transport_map, (void *)(intptr_t) fd);
+
+  sock_close (fd);
+
+  if (info)
+    {
+      hash_table_remove (transport_map, (void *)(intptr_t) fd);
+      xfree (info);
+      ++transport_map_modified_tick;
+    }
+}
+
+/* Put FD in non-blocking mode if NONBLOCKING is true, or back in
+   blocking mode otherwise.  Returns false on error.  */
+
+bool
+fd_set_nonblocking (int fd, bool nonblocking)
+{
+#ifdef F_GETFL
+  int flags = fcntl (fd, F_GETFL, 0);
+  if (flags < 0)
+    return false;
+  if (nonblocking)
+    flags |= O_NONBLOCK;
+  else
+    flags &= ~O_NONBLOCK;
+  return fcntl (fd, F_SETFL, flags) == 0;
+#else
+  const int arg = nonblocking;
+  return ioctl (fd, FIONBIO, &arg) == 0;
+#endif
+}
+
+/* Event loop.  An fd_loop waits for any of a set of descriptors to
+   become ready, and calls the function registered for each one that
+   is.  This way a single thread can drive many connections, from the
+   connection attempt started by connect_to_ip_start to the last byte
+   of the response.  The loop is built on epoll where available, and on
+   select otherwise.
+
+   The loop only reports readiness; the callbacks do the I/O with
+   fd_read, fd_write and friends, which use the transport registered
+   for the descriptor.  A transport such as SSL can hold decoded data
+   that is no longer visible on the socket, so a descriptor whose
+   transport has such data pending is reported readable at once.
+
+   The callbacks may add and remove descriptors, including their own.
+   They should be prepared for spurious readiness, as with select.  */
+
+struct fd_watch {
+  int fd;
+  int wait_for;                 /* WAIT_FOR_READ and/or WAIT_FOR_WRITE */
+  fd_loop_fn fn;                /* function to call when FD is ready */
+  void *arg;                    /* its last argument */
+};
+
+struct fd_loop {
+  struct hash_table *watches;   /* maps descriptors to fd_watch */
+  int epfd;                     /* the epoll descriptor, or -1 if select
+                                   is used */
+};
+
+/* The most descriptors dispatched by one call to fd_loop_run.  Those
+   left over are picked up by the next call.  */
+#define FD_LOOP_MAX_EVENTS 64
+
+/* Create an empty event loop. */
+
+struct fd_loop *
+fd_loop_new (void)
+{
+  struct fd_loop *loop = xnew0 (struct fd_loop);
+  loop->watches = hash_table_new (0, NULL, NULL);
+  loop->epfd = -1;
+#ifdef HAVE_SYS_EPOLL_H
+  loop->epfd = epoll_create (FD_LOOP_MAX_EVENTS);
+  if (loop->epfd < 0)
+    DEBUGP (("epoll_create failed, falling back to select: %s\n",
+             strerror (errno)));
+#endif
+  return loop;
+}
+
+/* Free LOOP.  The descriptors still in it are not closed.  */
+
+void
+fd_loop_delete (struct fd_loop *loop)
+{
+  hash_table_iterator iter;
+
+  for (hash_table_iterate (loop->watches, &iter);
+       hash_table_iter_next (&iter); )
+    xfree (iter.value);
+  hash_table_destroy (loop->watches);
+  if (loop->epfd >= 0)
+    close (loop->epfd);
+  xfree (loop);
+}
+
+#ifdef HAVE_SYS_EPOLL_H
+/* Tell epoll about the events WAIT_FOR asks for on FD.  */
+
+static bool
+fd_loop_epoll_ctl (struct fd_loop *loop, int op, int fd, int wait_for)
+{
+  struct epoll_event ev;
+
+  xzero (ev);
+  if (wait_for & WAIT_FOR_READ)
+    ev.events |= EPOLLIN;
+  if (wait_for & WAIT_FOR_WRITE)
+    ev.events |= EPOLLOUT;
+  ev.data.fd = fd;
+  return epoll_ctl (loop->epfd, op, fd, &ev) == 0;
+}
+#endif
+
+/* Have LOOP call FN with ARG when FD becomes ready for what WAIT_FOR
+   asks for.  FD must not already be in LOOP.  Returns false on error,
+   in which case errno is set.  */
+
+bool
+fd_loop_add (struct fd_loop *loop, int fd, int wait_for, fd_loop_fn fn,
+             void *arg)
+{
+  struct fd_watch *watch;
+
+  assert (fd >= 0);
+  assert (!hash_table_contains (loop->watches, (void *)(intptr_t) fd));
+
+#ifdef HAVE_SYS_EPOLL_H
+  if (loop->epfd >= 0)
+    {
+      if (!fd_loop_epoll_ctl (loop, EPOLL_CTL_ADD, fd, wait_for))
+        return false;
+    }
+  else
+#endif
+  if (fd >= FD_SETSIZE)
+    {
+      errno = EMFILE;
+      return false;
+    }
+
+  watch = xnew (struct fd_watch);
+  watch->fd = fd;
+  watch->wait_for = wait_for;
+  watch->fn = fn;
+  watch->arg = arg;
+  hash_table_put (loop->watches, (void *)(intptr_t) fd, watch);
+  return true;
+}
+
+/* Change the events LOOP waits for on FD to WAIT_FOR.  */
+
+bool
+fd_loop_modify (struct fd_loop *loop, int fd, int wait_for)
+{
+  struct fd_watch *watch = hash_table_get (loop->watches,
+                                           (void *)(intptr_t) fd);
+  if (!watch)
+    return false;
+  if (watch->wait_for == wait_for)
+    return true;
+#ifdef HAVE_SYS_EPOLL_H
+  if (loop->epfd >= 0
+      && !fd_loop_epoll_ctl (loop, EPOLL_CTL_MOD, fd, wait_for))
+    return false;
+#endif
+  watch->wait_for = wait_for;
+  return true;
+}
+
+/* Stop watching FD.  This must be done before FD is closed.  */
+
+void
+fd_loop_remove (struct fd_loop *loop, int fd)
+{
+  struct fd_watch *watch = hash_table_get (loop->watches,
+                                           (void *)(intptr_t) fd);
+  if (!watch)
+    return;
+#ifdef HAVE_SYS_EPOLL_H
+  if (loop->epfd >= 0)
+    fd_loop_epoll_ctl (loop, EPOLL_CTL_DEL, fd, 0);
+#endif
+  hash_table_remove (loop->watches, (void *)(intptr_t) fd);
+  xfree (watch);
+}
+
+/* Record that FD is ready for the events in EV, in the COUNT entries
+   of FDS and EVENTS.  Returns the new count.  */
+
+static int
+fd_loop_note_ready (int *fds, int *events, int count, int fd, int ev)
+{
+  int i;
+  for (i = 0; i < count; i++)
+    if (fds[i] == fd)
+      {
+        events[i] |= ev;
+        return count;
+      }
+  fds[count] = fd;
+  events[count] = ev;
+  return count + 1;
+}
+
+/* Note the descriptors of LOOP waiting for reading whose transport
+   already holds data.  */
+
+static int
+fd_loop_pending (struct fd_loop *loop, int *fds, int *events)
+{
+  hash_table_iterator iter;
+  int count = 0;
+
+  if (!transport_map)
+    return 0;
+  for (hash_table_iterate (transport_map, &iter);
+       count < FD_LOOP_MAX_EVENTS && hash_table_iter_next (&iter); )
+    {
+      struct transport_info *info = iter.value;
+      struct fd_watch *watch;
+      int fd = (intptr_t) iter.key;
+
+      if (!info->imp->pending)
+        continue;
+      watch = hash_table_get (loop->watches, iter.key);
+      if (watch && (watch->wait_for & WAIT_FOR_READ)
+          && info->imp->pending (fd, info->ctx) > 0)
+        count = fd_loop_note_ready (fds, events, count, fd, WAIT_FOR_READ);
+    }
+  return count;
+}
+
+/* Wait up to TIMEOUT seconds for the descriptors of LOOP, and add
+   those that are ready to the COUNT entries of FDS and EVENTS.
+   Returns the new count, or -1 on error.  */
+
+static int
+fd_loop_wait (struct fd_loop *loop, double timeout, int *fds, int *events,
+              int count)
+{
+#ifdef HAVE_SYS_EPOLL_H
+  if (loop->epfd >= 0)
+    {
+      struct epoll_event ev[FD_LOOP_MAX_EVENTS];
+      int ms = timeout < 0 ? -1 : (int) (timeout * 1000 + 0.999);
+      int i, n;
+
+      do
+        n = epoll_wait (loop->epfd, ev, countof (ev), ms);
+      while (n < 0 && errno == EINTR);
+      if (n < 0)
+        return -1;
+
+      for (i = 0; i < n; i++)
+        {
+          int e = 0;
+          if (ev[i].events & EPOLLIN)
+            e |= WAIT_FOR_READ;
+          if (ev[i].events & EPOLLOUT)
+            e |= WAIT_FOR_WRITE;
+          /* Errors and hangups are reported as readiness for whatever
+             the descriptor is waiting for, so that the callback gets to
+             see them when reading or writing.  */
+          if (ev[i].events & (EPOLLERR | EPOLLHUP))
+            e |= WAIT_FOR_READ | WAIT_FOR_WRITE;
+          count = fd_loop_note_ready (fds, events, count, ev[i].data.fd, e);
+        }
+      return count;
+    }
+#endif
+  {
+    fd_set rd, wr;
+    struct timeval tmout, *tp = NULL;
+    hash_table_iterator iter;
+    int maxfd = -1, n;
+
+    FD_ZERO (&rd);
+    FD_ZERO (&wr);
+    for (hash_table_iterate (loop->watches, &iter);
+         hash_table_iter_next (&iter); )
+      {
+        struct fd_watch *watch = iter.value;
+        if (watch->wait_for & WAIT_FOR_READ)
+          FD_SET (watch->fd, &rd);
+        if (watch->wait_for & WAIT_FOR_WRITE)
+          FD_SET (watch->fd, &wr);
+        maxfd = MAX (maxfd, watch->fd);
+      }
+    if (timeout >= 0)
+      {
+        tmout.tv_sec = (long) timeout;
+        tmout.tv_usec = 1000000 * (timeout - (long) timeout);
+        tp = &tmout;
+      }
+
+    do
+      n = select (maxfd + 1, &rd, &wr, NULL, tp);
+    while (n < 0 && errno == EINTR);
+    if (n < 0)
+      return -1;
+
+    for (hash_table_iterate (loop->watches, &iter);
+         n > 0 && count < 2 * FD_LOOP_MAX_EVENTS
+           && hash_table_iter_next (&iter); )
+      {
+        struct fd_watch *watch = iter.value;
+        int e = 0;
+        if (FD_ISSET (watch->fd, &rd))
+          e |= WAIT_FOR_READ;
+        if (FD_ISSET (watch->fd, &wr))
+          e |= WAIT_FOR_WRITE;
+        if (e)
+          {
+            count = fd_loop_note_ready (fds, events, count, watch->fd, e);
+            --n;
+          }
+      }
+    return count;
+  }
+}
+
+/* Wait up to TIMEOUT seconds for descriptors in LOOP to become ready,
+   and call the function registered for each of them.  A negative
+   TIMEOUT means waiting as long as it takes, and 0 means just checking.
+   Returns the number of descriptors dispatched, 0 on timeout, or -1 on
+   error.  */
+
+int
+fd_loop_run (struct fd_loop *loop, double timeout)
+{
+  int fds[2 * FD_LOOP_MAX_EVENTS], events[2 * FD_LOOP_MAX_EVENTS];
+  int count, i, dispatched = 0;
+
+  /* Don't wait for the socket if the transport already has data.  */
+  count = fd_loop_pending (loop, fds, events);
+  if (count)
+    timeout = 0;
+
+  count = fd_loop_wait (loop, timeout, fds, events, count);
+  if (count < 0)
+    return -1;
+
+  for (i = 0; i < count; i++)
+    {
+      /* Look the descriptor up again, as an earlier callback may have
+         removed it.  */
+      struct fd_watch *watch = hash_table_get (loop->watches,
+                                               (void *)(intptr_t) fds[i]);
+      int ev = watch ? events[i] & watch->wait_for : 0;
+      if (!ev)
+        continue;
+      watch->fn (fds[i], ev, watch->arg);
+      ++dispatched;
+    }
+  return dispatched;
+}
+
 #if defined DEBUG_MALLOC || defined TESTING
 void
 connect_cleanup(void)
@@ -1080,5 +1666,8 @@ connect_cleanup(void)
       hash_table_destroy (transport_map);
       transport_map = NULL;
     }
+#ifdef HAVE_SPLICE
+  splice_pipe_close ();
+#endif
 }
 #endif
@@ -41,6 +41,8 @@ enum {
 };
 int connect_to_host (const char *, int);
 int connect_to_ip (const ip_address *, int, const char *);
+int connect_to_ip_start (const ip_address *, int);
+int connect_finish (int);
 
 int bind_local (const ip_address *, int *);
 int accept_connection (int);
@@ -69,17 +71,40 @@ struct transport_implementation {
   int (*peeker) (int, char *, int, void *, double);
   const char *(*errstr) (int, void *);
   void (*closer) (int, void *);
+  int (*pending) (int, void *);
 };
 
 void fd_register_transport (int, struct transport_implementation *, void *);
 void *fd_transport_context (int);
+bool fd_transport_registered (int);
 int fd_read (int, char *, int, double);
 int fd_write (int, char *, int, double);
 int fd_peek (int, char *, int, double);
+#ifdef HAVE_SPLICE
+bool fd_splice_p (int);
+int fd_splice (int, int, int, double);
+#endif
 const char *fd_errstr (int);
 void fd_close (int);
+void fd_abandon (int);
+bool fd_set_nonblocking (int, bool);
 void connect_cleanup (void);
 
+/* The function an fd_loop calls when a descriptor is ready.  It gets
+   the descriptor, the WAIT_FOR_* flags it is ready for, and the
+   argument given to fd_loop_add.  */
+typedef void (*fd_loop_fn) (int, int, void *);
+
+struct fd_loop;                 /* forward declaration; all struct
+                                   members are private */
+
+struct fd_loop *fd_loop_new (void);
+void fd_loop_delete (struct fd_loop *);
+bool fd_loop_add (struct fd_loop *, int, int, fd_loop_fn, void *);
+bool fd_loop_modify (struct fd_loop *, int, int);
+void fd_loop_remove (struct fd_loop *, int);
+int fd_loop_run (struct fd_loop *, double);
+
 #ifdef WINDOWS
 int select_fd_nb (int, double, int);
 #else
@@ -36,6 +36,9 @@ as that of the covered work.  */
 #include <unistd.h>
 #include <errno.h>
 #include <assert.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/stat.h>
 #include "convert.h"
 #include "url.h"
 #include "recur.h"
@@ -47,125 +50,611 @@ as that of the covered work.  */
 #include "css-url.h"
 #include "iri.h"
 #include "xstrndup.h"
+#include "intern.h"
+#include "workers.h"
 
+/* The downloaded files and the URLs they were downloaded from, both
+   ways.  The keys and values are interned ids.  */
 static struct hash_table *dl_file_url_map;
-struct hash_table *dl_url_file_map;
+static struct hash_table *dl_url_file_map;
 
 /* Set of HTML/CSS files downloaded in this Wget run, used for link
    conversion after Wget is done.  */
 struct hash_table *downloaded_html_set;
 struct hash_table *downloaded_css_set;
 
-static void convert_links (const char *, struct urlpos *);
+/* Used by write_backup_file to remember which files have been
+   written. */
+static struct hash_table *converted_files;
 
+static bool convert_links (const char *, struct urlpos *);
+
+/* The new file convert_links is writing, if any.  It is removed if
+   Wget is interrupted or terminated meanwhile.  */
+static char *volatile convert_tmpname;
+static void (*convert_old_sigint) (int);
+static void (*convert_old_sigterm) (int);
 
 static void
-convert_links_in_hashtable (struct hash_table *downloaded_set,
-                            int is_css,
-                            int *file_count)
+convert_interrupted (int sig)
 {
-  int i, cnt = 0;
-  char *arr[1024], **file_array;
+  if (convert_tmpname)
+    unlink (convert_tmpname);
+  signal (sig, SIG_DFL);
+  raise (sig);
+}
 
-  if (!downloaded_set || (cnt = hash_table_count (downloaded_set)) == 0)
-    return;
+/* Create a new file from the template NAME, as mkstemp does.  The
+   file is removed if Wget is interrupted or terminated before
+   convert_tmp_done is called.  The signals are blocked until the name
+   is recorded, so that the file can't be left behind in between.
+   Signals that are ignored stay so.  */
 
-  if (cnt <= (int) countof (arr))
-    file_array = arr;
+static int
+convert_tmp_create (char *name)
+{
+  sigset_t block, old_mask;
+  int fd;
+
+  if ((convert_old_sigint = signal (SIGINT, convert_interrupted)) == SIG_IGN)
+    signal (SIGINT, SIG_IGN);
+  if ((convert_old_sigterm = signal (SIGTERM, convert_interrupted)) == SIG_IGN)
+    signal (SIGTERM, SIG_IGN);
+
+  sigemptyset (&block);
+  sigaddset (&block, SIGINT);
+  sigaddset (&block, SIGTERM);
+  sigprocmask (SIG_BLOCK, &block, &old_mask);
+  fd = mkstemp (name);
+  if (fd >= 0)
+    convert_tmpname = name;
+  sigprocmask (SIG_SETMASK, &old_mask, NULL);
+  return fd;
+}
+
+/* The file convert_tmp_create made has been renamed or removed.  */
+
+static void
+convert_tmp_done (void)
+{
+  convert_tmpname = NULL;
+  signal (SIGINT, convert_old_sigint);
+  signal (SIGTERM, convert_old_sigterm);
+}
+
+/* Look up the id KEY in MAP, which may be NULL.  Returns 0 if it is
+   not there.  */
+
+static intern_id
+map_get (struct hash_table *map, intern_id key)
+{
+  if (!map || !key)
+    return 0;
+  return PTR_TO_INTERN (hash_table_get (map, INTERN_TO_PTR (key)));
+}
+
+
+/* Decide how LINK, a link to the URL LOOKUP, is to be converted: a
+   link to a downloaded file is made to point to it, and the others are
+   made complete.  */
+
+static void
+plan_conversion (struct urlpos *link, const char *lookup,
+                 struct arena *arena)
+{
+  intern_id local_id = map_get (dl_url_file_map, intern_lookup (lookup));
+
+  /* Decide on the conversion type.  */
+  if (local_id)
+    {
+      char *local_name = intern_strdup (local_id);
+
+      /* We've downloaded this URL.  Convert it to relative
+         form.  We do this even if the URL already is in
+         relative form, because our directory structure may
+         not be identical to that on the server (think `-nd',
+         `--cut-dirs', etc.). If --convert-file-only was passed,
+         we only convert the basename portion of the URL.  */
+      link->convert = (opt.convert_file_only ? CO_CONVERT_BASENAME_ONLY : CO_CONVERT_TO_RELATIVE);
+      link->local_name = arena_strdup (arena, local_name);
+      DEBUGP (("will convert url %s to local %s\n", lookup, local_name));
+      xfree (local_name);
+    }
   else
-    file_array = xmalloc (cnt * sizeof (arr[0]));
+    {
+      /* We haven't downloaded this URL.  If it's not already
+         complete (including a full host name), convert it to
+         that form, so it can be reached while browsing this
+         HTML locally.  */
+      link->convert = (link->link_complete_p ? CO_NOCONVERT
+                       : CO_CONVERT_TO_COMPLETE);
+      link->local_name = NULL;
+      DEBUGP (("will convert url %s to complete\n", lookup));
+    }
+}
 
-  string_set_to_array (downloaded_set, file_array);
+/* Decide how each of LINKS, the links found in a document, is to be
+   converted.  With EARLY, the decision is put off: the links are made
+   CO_PENDING, with the URL to look up in local_name, for
+   plan_pending_conversions to decide on later.  */
+
+static void
+plan_conversions (struct urlpos *links, bool early, struct arena *arena)
+{
+  struct urlpos *cur_url;
 
-  for (i = 0; i < cnt; i++)
+  for (cur_url = links; cur_url; cur_url = cur_url->next)
     {
-      struct urlpos *urls, *cur_url;
-      char *url;
-      char *file = file_array[i];
-
-      /* Determine the URL of the file.  get_urls_{html,css} will need
-         it.  */
-      url = hash_table_get (dl_file_url_map, file);
-      if (!url)
+      struct url *u;
+      struct iri *pi;
+
+      if (cur_url->link_base_p)
         {
-          DEBUGP (("Apparently %s has been removed.\n", file));
+          /* Base references have been resolved by our parser, so
+             we turn the base URL into an empty string.  (Perhaps
+             we should remove the tag entirely?)  */
+          cur_url->convert = CO_NULLIFY_BASE;
           continue;
         }
 
-      DEBUGP (("Scanning %s (from %s)\n", file, url));
+      /* We decide the direction of conversion according to whether
+         a URL was downloaded.  Downloaded URLs will be converted
+         ABS2REL, whereas non-downloaded will be converted REL2ABS.  */
 
-      /* Parse the file...  */
-      urls = is_css ? get_urls_css_file (file, url) :
-                      get_urls_html (file, url, NULL, NULL);
+      pi = iri_new ();
+      set_uri_encoding (pi, opt.locale, true);
 
-      /* We don't respect meta_disallow_follow here because, even if
-         the file is not followed, we might still want to convert the
-         links that have been followed from other files.  */
+      u = url_parse_arena (cur_url->url->url, NULL, pi, true, arena);
+      if (!u)
+          continue;
 
-      for (cur_url = urls; cur_url; cur_url = cur_url->next)
+      if (early)
         {
-          char *local_name;
-          struct url *u;
-          struct iri *pi;
+          cur_url->convert = CO_PENDING;
+          cur_url->local_name = arena_strdup (arena, u->url);
+        }
+      else
+        plan_conversion (cur_url, u->url, arena);
 
-          if (cur_url->link_base_p)
-            {
-              /* Base references have been resolved by our parser, so
-                 we turn the base URL into an empty string.  (Perhaps
-                 we should remove the tag entirely?)  */
-              cur_url->convert = CO_NULLIFY_BASE;
-              continue;
-            }
+      iri_free (pi);
+    }
+}
+
+/* Decide on the CO_PENDING links among LINKS.  */
+
+static void
+plan_pending_conversions (struct urlpos *links, struct arena *arena)
+{
+  struct urlpos *link;
 
-          /* We decide the direction of conversion according to whether
-             a URL was downloaded.  Downloaded URLs will be converted
-             ABS2REL, whereas non-downloaded will be converted REL2ABS.  */
+  for (link = links; link; link = link->next)
+    if (link->convert == CO_PENDING)
+      plan_conversion (link, link->local_name, arena);
+}
+
+/* Convert the links in FILE, which is a CSS file if IS_CSS and an
+   HTML file otherwise.  The links are allocated from ARENA, which is
+   freed afterwards.  Returns false if FILE is no longer in the
+   download registry.  */
+
+static bool
+convert_file (const char *file, bool is_css, struct arena *arena)
+{
+  struct urlpos *urls;
+  char *url;
+  intern_id url_id;
+
+  /* Determine the URL of the file.  get_urls_{html,css} will need
+     it.  */
+  url_id = map_get (dl_file_url_map, intern_lookup (file));
+  if (!url_id)
+    {
+      DEBUGP (("Apparently %s has been removed.\n", file));
+      return false;
+    }
+  url = intern_strdup (url_id);
+
+  DEBUGP (("Scanning %s (from %s)\n", file, url));
 
-          pi = iri_new ();
-          set_uri_encoding (pi, opt.locale, true);
+  /* Parse the file...  The links are only needed until the file is
+     converted, so allocate them from the arena.  */
+  urls = is_css ? get_urls_css_file (file, url, arena) :
+                  get_urls_html (file, url, NULL, NULL, arena);
 
-          u = url_parse (cur_url->url->url, NULL, pi, true);
-          if (!u)
-              continue;
+  /* We don't respect meta_disallow_follow here because, even if the
+     file is not followed, we might still want to convert the links
+     that have been followed from other files.  */
 
-          local_name = hash_table_get (dl_url_file_map, u->url);
+  plan_conversions (urls, false, arena);
 
-          /* Decide on the conversion type.  */
-          if (local_name)
+  /* Convert the links in the file.  */
+  convert_links (file, urls);
+
+  /* Free the data.  */
+  arena_free (arena);
+  xfree (url);
+  return true;
+}
+
+/* Link conversion with --convert-early.  The links of a document are
+   converted as soon as the recursive retrieval has parsed it, using
+   the links found then.  If all of them point to files that are
+   already downloaded, the document is converted right away.
+   Otherwise it is too soon to tell where they should point, so the
+   document is left alone, and its links are written to a temporary
+   file along with their positions.  convert_all_links then converts
+   the document from these, without parsing it again.  Either way, a
+   document is only rewritten once, but it is rewritten in full: the
+   converted links don't have the length of the original ones, so
+   what this saves is the parse, not the copy.  */
+
+/* The files whose links were converted early, as interned ids.  The
+   value is one past the offset of the file's links in early_links_fp,
+   or 0 if the file has been converted already.  A file downloaded
+   again is removed, and its links recorded before are then
+   ignored.  */
+static struct hash_table *early_files;
+
+/* The links left for the end.  For each file that has some, the name
+   of the file and the number of links, followed by the links.  */
+static FILE *early_links_fp;
+static bool early_links_failed;
+
+#define EARLY_CSS 1
+#define EARLY_NOQUOTE_HTML 2
+#define EARLY_REFRESH 4
+#define EARLY_COMPLETE 8
+#define EARLY_BASE 16
+
+/* Convert the links in FILE, which the recursive retrieval has just
+   parsed into LINKS, allocated from ARENA.  */
+
+void
+convert_links_early (const char *file, struct urlpos *links,
+                     struct arena *arena)
+{
+  intern_id file_id = intern_lookup (file);
+  struct urlpos *link;
+  unsigned long count = 0;
+  uintptr_t record = 0;
+  bool pending = false;
+
+  if (!file_id || !map_get (dl_file_url_map, file_id) || early_links_failed)
+    return;
+  /* The links of a file parsed again are the same.  */
+  if (early_files
+      && hash_table_contains (early_files, INTERN_TO_PTR (file_id)))
+    return;
+
+  plan_conversions (links, true, arena);
+  for (link = links; link; link = link->next)
+    if (link->convert == CO_PENDING || link->convert == CO_NULLIFY_BASE)
+      {
+        ++count;
+        if (link->convert == CO_PENDING
+            && !map_get (dl_url_file_map, intern_lookup (link->local_name)))
+          pending = true;
+      }
+
+  if (!pending)
+    {
+      plan_pending_conversions (links, arena);
+      if (!convert_links (file, links))
+        return;
+    }
+  else
+    {
+      if (!early_links_fp)
+        {
+          early_links_fp = tmpfile ();
+          if (!early_links_fp)
             {
-              /* We've downloaded this URL.  Convert it to relative
-                 form.  We do this even if the URL already is in
-                 relative form, because our directory structure may
-                 not be identical to that on the server (think `-nd',
-                 `--cut-dirs', etc.). If --convert-file-only was passed,
-                 we only convert the basename portion of the URL.  */
-              cur_url->convert = (opt.convert_file_only ? CO_CONVERT_BASENAME_ONLY : CO_CONVERT_TO_RELATIVE);
-              cur_url->local_name = xstrdup (local_name);
-              DEBUGP (("will convert url %s to local %s\n", u->url, local_name));
+              logprintf (LOG_NOTQUIET,
+                         _("Cannot create a temporary file for link conversion: %s\n"),
+                         strerror (errno));
+              early_links_failed = true;
+              return;
             }
-          else
+        }
+
+      record = ftell (early_links_fp) + 1;
+      fput_string (early_links_fp, file);
+      fput_number (early_links_fp, count);
+      for (link = links; link; link = link->next)
+        if (link->convert == CO_PENDING || link->convert == CO_NULLIFY_BASE)
+          {
+            bool base = link->convert == CO_NULLIFY_BASE;
+
+            /* The text of a complete link is the URL as parsed, which
+               is usually the same as the one to look up.  */
+            fput_string (early_links_fp, base ? NULL : link->local_name);
+            fput_string (early_links_fp,
+                         !base && strcmp (link->url->url, link->local_name)
+                         ? link->url->url : NULL);
+            fput_number (early_links_fp, link->pos);
+            fput_number (early_links_fp, link->size);
+            fput_number (early_links_fp,
+                         (link->link_css_p ? EARLY_CSS : 0)
+                         | (link->link_noquote_html_p ? EARLY_NOQUOTE_HTML : 0)
+                         | (link->link_refresh_p ? EARLY_REFRESH : 0)
+                         | (link->link_complete_p ? EARLY_COMPLETE : 0)
+                         | (base ? EARLY_BASE : 0));
+            fput_number (early_links_fp, link->refresh_timeout);
+          }
+    }
+
+  if (!early_files)
+    early_files = hash_table_new (0, NULL, NULL);
+  hash_table_put (early_files, INTERN_TO_PTR (file_id), (void *) record);
+}
+
+/* Return true if the links in FILE have been converted early, so that
+   they can't be found by parsing it again.  */
+
+bool
+converted_early (const char *file)
+{
+  void *record;
+
+  return early_files
+    && hash_table_get_pair (early_files,
+                            INTERN_TO_PTR (intern_lookup (file)),
+                            NULL, &record)
+    && !record;
+}
+
+/* Read the links of one file from the links left for the end, into
+   links allocated from ARENA.  Returns NULL at the end of the file or
+   if it is corrupt.  */
+
+static struct urlpos *
+read_early_links (char **file, struct arena *arena)
+{
+  struct urlpos *links, *link;
+  unsigned long count, i;
+
+  if (!fget_string (early_links_fp, file) || !*file)
+    return NULL;
+  if (!fget_number (early_links_fp, &count) || !count
+      || count > INT_MAX / sizeof (struct urlpos))
+    {
+      xfree (*file);
+      return NULL;
+    }
+
+  links = arena_alloc (arena, count * sizeof (struct urlpos));
+  memset (links, 0, count * sizeof (struct urlpos));
+  for (i = 0; i < count; i++)
+    {
+      char *lookup = NULL, *text = NULL;
+      unsigned long pos = 0, size = 0, flags = 0, timeout = 0;
+      bool ok = (fget_string (early_links_fp, &lookup)
+                 && fget_string (early_links_fp, &text)
+                 && fget_number (early_links_fp, &pos)
+                 && fget_number (early_links_fp, &size)
+                 && fget_number (early_links_fp, &flags)
+                 && fget_number (early_links_fp, &timeout)
+                 && (lookup || (flags & EARLY_BASE)));
+
+      link = &links[i];
+      link->url = arena_alloc (arena, sizeof (struct url));
+      memset (link->url, 0, sizeof (struct url));
+      link->url->url = arena_strdup (arena, text ? text
+                                     : lookup ? lookup : "");
+      link->local_name = lookup ? arena_strdup (arena, lookup) : NULL;
+      link->convert = (flags & EARLY_BASE) ? CO_NULLIFY_BASE : CO_PENDING;
+      link->pos = pos;
+      link->size = size;
+      link->link_css_p = !!(flags & EARLY_CSS);
+      link->link_noquote_html_p = !!(flags & EARLY_NOQUOTE_HTML);
+      link->link_refresh_p = !!(flags & EARLY_REFRESH);
+      link->link_complete_p = !!(flags & EARLY_COMPLETE);
+      link->link_base_p = !!(flags & EARLY_BASE);
+      link->refresh_timeout = timeout;
+      if (i > 0)
+        links[i - 1].next = link;
+      xfree (lookup);
+      xfree (text);
+      if (!ok)
+        {
+          xfree (*file);
+          return NULL;
+        }
+    }
+  return links;
+}
+
+/* Convert the files whose links convert_links_early left for the end.
+   Adds the number of files to *FILE_COUNT.  */
+
+static void
+convert_pending_links (int *file_count)
+{
+  struct urlpos *links;
+  struct arena arena;
+  char *file;
+
+  if (!early_links_fp)
+    return;
+
+  xzero (arena);
+  rewind (early_links_fp);
+  for (;;)
+    {
+      uintptr_t record = ftell (early_links_fp) + 1;
+      intern_id file_id;
+
+      links = read_early_links (&file, &arena);
+      if (!links)
+        break;
+      file_id = intern_lookup (file);
+      /* The file may have been downloaded again, or removed, since.  */
+      if ((uintptr_t) hash_table_get (early_files,
+                                      INTERN_TO_PTR (file_id)) == record
+          && map_get (dl_file_url_map, file_id))
+        {
+          plan_pending_conversions (links, &arena);
+          convert_links (file, links);
+          ++*file_count;
+        }
+
+      arena_free (&arena);
+      xfree (file);
+    }
+  arena_free (&arena);
+
+  fclose (early_links_fp);
+  early_links_fp = NULL;
+}
+
+/* Link conversion with --parallel.  Each file is converted on its own
+   and only reads the download registry, which no longer changes at
+   this point, so the files are simply handed out to a pool of worker
+   processes, which get a copy of the registry when they are forked.
+   The output of each file is captured by the worker and printed in
+   one piece by the main process.  */
+
+static void
+convert_job (struct wmsg *job, struct wmsg *reply)
+{
+  char *file = msg_get_string (job);
+  bool is_css = msg_get_number (job);
+  struct arena arena;
+  char *log_text;
+  bool converted;
+
+  log_capture_start ();
+  xzero (arena);
+  converted = file && convert_file (file, is_css, &arena);
+  log_text = log_capture_text ();
+
+  msg_put_number (reply, converted);
+  /* Tell the main process about the backup, so that a later pass over
+     the same file doesn't overwrite it.  */
+  msg_put_number (reply, converted_files && file
+                  && string_set_contains (converted_files, file));
+  msg_put_string (reply, log_text);
+
+  xfree (log_text);
+  xfree (file);
+}
+
+/* Convert the CNT files in FILES in POOL, adding the number of
+   converted files to *FILE_COUNT.  The files of jobs that are lost
+   because their worker died are converted by the main process.  */
+
+static void
+convert_files_in_pool (struct worker_pool *pool, char **files, int cnt,
+                       bool is_css, int *file_count)
+{
+  /* Maps job ids to indices in FILES. */
+  struct hash_table *jobs = hash_table_new (0, NULL, NULL);
+  struct wmsg msg;
+  struct arena arena;
+  const char *file;
+  int next = 0, job;
+
+  msg_init (&msg);
+  xzero (arena);
+
+  while (next < cnt || worker_pool_busy (pool))
+    {
+      while (next < cnt)
+        {
+          msg_reset (&msg);
+          msg_put_string (&msg, files[next]);
+          msg_put_number (&msg, is_css);
+          job = worker_pool_submit (pool, &msg);
+          if (job < 0)
+            break;
+          hash_table_put (jobs, (void *) (intptr_t) job,
+                          (void *) (intptr_t) next);
+          ++next;
+        }
+
+      job = worker_pool_collect (pool, true, &msg);
+      if (job < 0)
+        break;
+      file = files[(intptr_t) hash_table_get (jobs, (void *) (intptr_t) job)];
+      hash_table_remove (jobs, (void *) (intptr_t) job);
+
+      if (msg.size)
+        {
+          char *log_text;
+
+          if (msg_get_number (&msg))
+            ++*file_count;
+          if (msg_get_number (&msg))
             {
-              /* We haven't downloaded this URL.  If it's not already
-                 complete (including a full host name), convert it to
-                 that form, so it can be reached while browsing this
-                 HTML locally.  */
-              if (!cur_url->link_complete_p)
-                cur_url->convert = CO_CONVERT_TO_COMPLETE;
-              cur_url->local_name = NULL;
-              DEBUGP (("will convert url %s to complete\n", u->url));
+              if (!converted_files)
+                converted_files = make_string_hash_table (0);
+              string_set_add (converted_files, file);
             }
-
-          url_free (u);
-          iri_free (pi);
+          log_text = msg_get_string (&msg);
+          if (log_text)
+            logputs (LOG_ALWAYS, log_text);
+          xfree (log_text);
         }
+      else if (convert_file (file, is_css, &arena))
+        ++*file_count;
+    }
 
-      /* Convert the links in the file.  */
-      convert_links (file, urls);
+  /* No worker is left; do the rest here.  */
+  for (; next < cnt; next++)
+    if (convert_file (files[next], is_css, &arena))
       ++*file_count;
 
-      /* Free the data.  */
-      free_urlpos (urls);
+  hash_table_destroy (jobs);
+  msg_free (&msg);
+}
+
+static void
+convert_links_in_hashtable (struct hash_table *downloaded_set,
+                            int is_css,
+                            int *file_count)
+{
+  int i, cnt = 0;
+  char *arr[1024], **file_array;
+  struct worker_pool *pool = NULL;
+  struct arena arena;
+
+  if (!downloaded_set || (cnt = hash_table_count (downloaded_set)) == 0)
+    return;
+
+  if (cnt <= (int) countof (arr))
+    file_array = arr;
+  else
+    file_array = xmalloc (cnt * sizeof (arr[0]));
+
+  string_set_to_array (downloaded_set, file_array);
+  xzero (arena);
+
+  /* The files seen by convert_links_early have been converted already,
+     or are converted by convert_pending_links.  */
+  if (early_files)
+    {
+      int kept = 0;
+      for (i = 0; i < cnt; i++)
+        if (!hash_table_contains (early_files,
+                                  INTERN_TO_PTR (intern_lookup (file_array[i]))))
+          file_array[kept++] = file_array[i];
+      cnt = kept;
+    }
+
+  /* The pool is forked for each set, so that the workers converting
+     the CSS files know about the backups made for the HTML files.  */
+  if (opt.parallel > 1 && cnt > 1)
+    pool = worker_pool_new (MIN (opt.parallel, cnt), convert_job);
+
+  if (pool)
+    {
+      convert_files_in_pool (pool, file_array, cnt, is_css, file_count);
+      worker_pool_delete (pool);
     }
+  else
+    for (i = 0; i < cnt; i++)
+      if (convert_file (file_array[i], is_css, &arena))
+        ++*file_count;
 
   if (file_array != arr)
     xfree (file_array);
@@ -184,22 +673,48 @@ convert_links_in_hashtable (struct hash_table *downloaded_set,
 
    All the downloaded HTMLs are kept in downloaded_html_files, and
    downloaded URLs in urls_downloaded.  All the information is
-   extracted from these two lists.  */
+   extracted from these two lists.
+
+   With --parallel, the files are converted by worker processes.
+   With --convert-early, most files have been converted already, and
+   the others are converted from the links recorded then.  */
 
 void
 convert_all_links (void)
 {
   double secs;
-  int file_count = 0;
+  int file_count = 0, pending_count = 0;
 
   struct ptimer *timer = ptimer_new ();
 
+  convert_pending_links (&pending_count);
+  file_count = pending_count;
   convert_links_in_hashtable (downloaded_html_set, 0, &file_count);
   convert_links_in_hashtable (downloaded_css_set, 1, &file_count);
 
   secs = ptimer_measure (timer);
-  logprintf (LOG_VERBOSE, _("Converted links in %d files in %s seconds.\n"),
-             file_count, print_decimal (secs));
+  if (opt.parallel > 1)
+    logprintf (LOG_VERBOSE,
+               _("Converted links in %d files in %s seconds "
+                 "using up to %d processes.\n"),
+               file_count, print_decimal (secs), opt.parallel);
+  else
+    logprintf (LOG_VERBOSE, _("Converted links in %d files in %s seconds.\n"),
+               file_count, print_decimal (secs));
+  if (early_files)
+    {
+      hash_table_iterator iter;
+      int early_count = 0;
+
+      for (hash_table_iterate (early_files, &iter);
+           hash_table_iter_next (&iter); )
+        if (!iter.value)
+          ++early_count;
+      logprintf (LOG_VERBOSE,
+                 _("Converted links in %d files while downloading, "
+                   "and in %d files from the links recorded then.\n"),
+                 early_count, pending_count);
+    }
 
   ptimer_destroy (timer);
 }
@@ -213,16 +728,74 @@ static char *local_quote_string (const char *, bool);
 static char *construct_relative (const char *, const char *);
 static char *convert_basename (const char *, const struct urlpos *);
 
+/* Size of the stdio buffer for writing converted files.  */
+#define CONVERT_BUFFER_SIZE (256 * 1024)
+
+/* Unchanged spans at least this long are copied in the kernel.  */
+#define COPY_RANGE_MIN (64 * 1024)
+
+/* Write the LEN bytes at P, which lie in FM read from FILE, to FP.
+   Long spans are copied from FILE to FP by copy_file_range where the
+   system has it, which spares the user-space copy and lets file
+   systems that support it share the blocks.  *IN_FD holds the
+   descriptor of FILE, -1 if not yet open, or -2 if copy_file_range
+   has failed for this file.  */
+static void
+write_span (FILE *fp, const char *file, const struct file_memory *fm,
+            const char *p, size_t len, int *in_fd)
+{
+#ifdef HAVE_COPY_FILE_RANGE
+  if (len >= COPY_RANGE_MIN && *in_fd != -2)
+    {
+      off_t in_off = p - fm->content;
+      off_t out_off;
+
+      if (*in_fd == -1)
+        *in_fd = open (file, O_RDONLY);
+      if (*in_fd >= 0 && fflush (fp) == 0 && (out_off = ftello (fp)) >= 0)
+        {
+          while (len > 0)
+            {
+              ssize_t n = copy_file_range (*in_fd, &in_off, fileno (fp),
+                                           &out_off, len, 0);
+              if (n <= 0)
+                break;
+              p += n;
+              len -= n;
+            }
+          /* copy_file_range doesn't move the file offsets; move the
+             stream past what was copied so that ftell stays right.  */
+          if (fseeko (fp, out_off, SEEK_SET) == 0 && len == 0)
+            return;
+        }
+      /* Don't try again for this file; write the rest ourselves.  */
+      if (*in_fd >= 0)
+        close (*in_fd);
+      *in_fd = -2;
+    }
+#else
+  (void) file;
+  (void) fm;
+  (void) in_fd;
+#endif
+  fwrite (p, 1, len, fp);
+}
+
 /* Change the links in one file.  LINKS is a list of links in the
    document, along with their positions and the desired direction of
-   the conversion.  */
-static void
+   the conversion.  Returns false if the file could not be
+   converted.  */
+static bool
 convert_links (const char *file, struct urlpos *links)
 {
   struct file_memory *fm;
   FILE *fp;
   const char *p;
   downloaded_file_t downloaded_file_return;
+  char *tmpname;
+  int fd, in_fd = -1;
+  struct stat st;
+  bool ok;
 
   struct urlpos *link;
   int to_url_count = 0, to_file_count = 0;
@@ -241,7 +814,7 @@ convert_links (const char *file, struct urlpos *links)
     if (!dry_count)
       {
         logputs (LOG_VERBOSE, _("nothing to do.\n"));
-        return;
+        return true;
       }
     logprintf (LOG_VERBOSE, _("%d.\n"), dry_count);
   }
@@ -251,33 +824,30 @@ convert_links (const char *file, struct urlpos *links)
     {
       logprintf (LOG_NOTQUIET, _("Cannot convert links in %s: %s\n"),
                  file, strerror (errno));
-      return;
+      return false;
     }
 
-  downloaded_file_return = downloaded_file (CHECK_FOR_FILE, file);
-  if (opt.backup_converted && downloaded_file_return)
-    write_backup_file (file, downloaded_file_return);
-
-  /* Before opening the file for writing, unlink the file.  This is
-     important if the data in FM is mapped.  In such case, nulling the
-     file, which is what fopen() below does, would make us read all
-     zeroes from the mapped region.  */
-  if (unlink (file) < 0 && errno != ENOENT)
-    {
-      logprintf (LOG_NOTQUIET, _("Unable to delete %s: %s\n"),
-                 quote (file), strerror (errno));
-      wget_read_file_free (fm);
-      return;
-    }
-  /* Now open the file for writing.  */
-  fp = fopen (file, "wb");
+  /* Write the converted text to a new file next to FILE and rename it
+     over FILE when done.  FILE is never left half written, and the
+     data in FM stays valid even if it is mapped.  */
+  tmpname = aprintf ("%s.XXXXXX", file);
+  fd = convert_tmp_create (tmpname);
+  fp = fd >= 0 ? fdopen (fd, "wb") : NULL;
   if (!fp)
     {
       logprintf (LOG_NOTQUIET, _("Cannot convert links in %s: %s\n"),
                  file, strerror (errno));
+      if (fd >= 0)
+        {
+          close (fd);
+          unlink (tmpname);
+        }
+      convert_tmp_done ();
+      xfree (tmpname);
       wget_read_file_free (fm);
-      return;
+      return false;
     }
+  setvbuf (fp, NULL, _IOFBF, CONVERT_BUFFER_SIZE);
 
   /* Here we loop through all the URLs in file, replacing those of
      them that are downloaded with relative references.  */
@@ -300,7 +870,7 @@ convert_links (const char *file, struct urlpos *links)
 
       /* Echo the file contents, up to the offending URL's opening
          quote, to the outfile.  */
-      fwrite (p, 1, url_start - p, fp);
+      write_span (fp, file, fm, p, url_start - p, &in_fd);
       p = url_start;
 
       switch (link->convert)
@@ -376,6 +946,7 @@ convert_links (const char *file, struct urlpos *links)
           p = replace_attr (p, link->size, fp, "");
           break;
         case CO_NOCONVERT:
+        case CO_PENDING:
           abort ();
           break;
         }
@@ -383,11 +954,43 @@ convert_links (const char *file, struct urlpos *links)
 
   /* Output the rest of the file. */
   if (p - fm->content < fm->length)
-    fwrite (p, 1, fm->length - (p - fm->content), fp);
-  fclose (fp);
+    write_span (fp, file, fm, p, fm->length - (p - fm->content), &in_fd);
+  if (in_fd >= 0)
+    close (in_fd);
+
+  /* The new text must reach the disk before the rename does, or a
+     crash could leave an empty file in place of FILE.  */
+  ok = fflush (fp) == 0 && !ferror (fp) && fsync (fileno (fp)) == 0;
+  if (fclose (fp) != 0)
+    ok = false;
+  /* Give the new file the permissions of the one it replaces.  */
+  if (ok && stat (file, &st) == 0)
+    chmod (tmpname, st.st_mode & 07777);
+
+  if (ok)
+    {
+      downloaded_file_return = downloaded_file (CHECK_FOR_FILE, file);
+      if (opt.backup_converted && downloaded_file_return)
+        write_backup_file (file, downloaded_file_return);
+#if defined(WINDOWS) || defined(MSDOS)
+      /* rename doesn't replace an existing file here.  */
+      unlink (file);
+#endif
+      ok = rename (tmpname, file) == 0;
+    }
+  if (!ok)
+    {
+      logprintf (LOG_NOTQUIET, _("Cannot convert links in %s: %s\n"),
+                 file, strerror (errno));
+      unlink (tmpname);
+    }
+  convert_tmp_done ();
+  xfree (tmpname);
   wget_read_file_free (fm);
 
-  logprintf (LOG_VERBOSE, "%d-%d\n", to_file_count, to_url_count);
+  if (ok)
+    logprintf (LOG_VERBOSE, "%d-%d\n", to_file_count, to_url_count);
+  return ok;
 }
 
 /* Construct and return a link that points from BASEFILE to LINKFILE.
@@ -528,10 +1131,6 @@ convert_basename (const char *p, const struct urlpos *link)
   return result;
 }
 
-/* Used by write_backup_file to remember which files have been
-   written. */
-static struct hash_table *converted_files;
-
 static void
 write_backup_file (const char *file, downloaded_file_t downloaded_file_return)
 {
@@ -581,10 +1180,22 @@ write_backup_file (const char *file, downloaded_file_t downloaded_file_return)
           strcpy (filename_plus_orig_suffix + filename_len, ORIG_SFX);
         }
 
-      /* Rename <file> to <file>.orig before former gets written over. */
-      if (rename (file, filename_plus_orig_suffix) != 0)
-        logprintf (LOG_NOTQUIET, _("Cannot back up %s as %s: %s\n"),
-                   file, filename_plus_orig_suffix, strerror (errno));
+      /* Link <file> to <file>.orig before the converted version is
+         renamed over the former.  Fall back to renaming <file> where
+         hard links can't be made.  */
+      {
+        bool backed_up = false;
+#ifdef HAVE_LINK
+        if (link (file, filename_plus_orig_suffix) == 0
+            || (errno == EEXIST
+                && unlink (filename_plus_orig_suffix) == 0
+                && link (file, filename_plus_orig_suffix) == 0))
+          backed_up = true;
+#endif
+        if (!backed_up && rename (file, filename_plus_orig_suffix) != 0)
+          logprintf (LOG_NOTQUIET, _("Cannot back up %s as %s: %s\n"),
+                     file, filename_plus_orig_suffix, strerror (errno));
+      }
 
       if (filename_plus_orig_suffix != buf)
         xfree (filename_plus_orig_suffix);
@@ -802,9 +1413,9 @@ local_quote_string (const char *file, bool no_html_quote)
 
 #define ENSURE_TABLES_EXIST do {                        \
   if (!dl_file_url_map)                                 \
-    dl_file_url_map = make_string_hash_table (0);       \
+    dl_file_url_map = hash_table_new (0, NULL, NULL);   \
   if (!dl_url_file_map)                                 \
-    dl_url_file_map = make_string_hash_table (0);       \
+    dl_url_file_map = hash_table_new (0, NULL, NULL);   \
 } while (0)
 
 /* Return true if S1 and S2 are the same, except for "/index.html".
@@ -864,16 +1475,10 @@ match_except_index (const char *s1, const char *s2)
 static int
 dissociate_urls_from_file_mapper (void *key, void *value, void *arg)
 {
-  char *mapping_url = (char *)key;
-  char *mapping_file = (char *)value;
-  char *file = (char *)arg;
+  intern_id *file = arg;
 
-  if (0 == strcmp (mapping_file, file))
-    {
-      hash_table_remove (dl_url_file_map, mapping_url);
-      xfree (mapping_url);
-      xfree (mapping_file);
-    }
+  if (PTR_TO_INTERN (value) == *file)
+    hash_table_remove (dl_url_file_map, key);
 
   /* Continue mapping. */
   return 0;
@@ -882,11 +1487,11 @@ dissociate_urls_from_file_mapper (void *key, void *value, void *arg)
 /* Remove all associations from various URLs to FILE from dl_url_file_map. */
 
 static void
-dissociate_urls_from_file (const char *file)
+dissociate_urls_from_file (intern_id file)
 {
   /* Can't use hash_table_iter_* because the table mutates while mapping.  */
   hash_table_for_each (dl_url_file_map, dissociate_urls_from_file_mapper,
-                       (char *) file);
+                       &file);
 }
 
 /* Register that URL has been successfully downloaded to FILE.  This
@@ -897,7 +1502,8 @@ dissociate_urls_from_file (const char *file)
 void
 register_download (const char *url, const char *file)
 {
-  char *old_file, *old_url;
+  intern_id url_id = intern (url), file_id = intern (file);
+  intern_id old_url_id;
 
   ENSURE_TABLES_EXIST;
 
@@ -906,24 +1512,29 @@ register_download (const char *url, const char *file)
      download will override the first one.  When that happens,
      dissociate the old file name from the URL.  */
 
-  if (hash_table_get_pair (dl_file_url_map, file, &old_file, &old_url))
+  old_url_id = map_get (dl_file_url_map, file_id);
+  if (old_url_id)
     {
-      if (0 == strcmp (url, old_url))
+      char *old_url;
+      bool index_only;
+
+      if (url_id == old_url_id)
         /* We have somehow managed to download the same URL twice.
            Nothing to do.  */
         return;
 
-      if (match_except_index (url, old_url)
-          && !hash_table_contains (dl_url_file_map, url))
+      old_url = intern_strdup (old_url_id);
+      index_only = match_except_index (url, old_url)
+        && !hash_table_contains (dl_url_file_map, INTERN_TO_PTR (url_id));
+      xfree (old_url);
+      if (index_only)
         /* The two URLs differ only in the "index.html" ending.  For
            example, one is "http://www.server.com/", and the other is
            "http://www.server.com/index.html".  Don't remove the old
            one, just add the new one as a non-canonical entry.  */
         goto url_only;
 
-      hash_table_remove (dl_file_url_map, file);
-      xfree (old_file);
-      xfree (old_url);
+      hash_table_remove (dl_file_url_map, INTERN_TO_PTR (file_id));
 
       /* Remove all the URLs that point to this file.  Yes, there can
          be more than one such URL, because we store redirections as
@@ -938,10 +1549,11 @@ register_download (const char *url, const char *file)
          called very rarely, only when two URLs resolve to the same
          file name, *and* the "<file>.1" extensions are turned off.
          In other words, almost never.  */
-      dissociate_urls_from_file (file);
+      dissociate_urls_from_file (file_id);
     }
 
-  hash_table_put (dl_file_url_map, xstrdup (file), xstrdup (url));
+  hash_table_put (dl_file_url_map, INTERN_TO_PTR (file_id),
+                  INTERN_TO_PTR (url_id));
 
  url_only:
   /* A URL->FILE mapping is not possible without a FILE->URL mapping.
@@ -959,15 +1571,9 @@ register_download (const char *url, const char *file)
      then the first URL will resolve to "FILE", and the other to
      "FILE.1".  In that case, FILE.1 will not be found in
      dl_file_url_map, but URL will still point to FILE in
-     dl_url_file_map.  */
-  if (hash_table_get_pair (dl_url_file_map, url, &old_url, &old_file))
-    {
-      hash_table_remove (dl_url_file_map, url);
-      xfree (old_url);
-      xfree (old_file);
-    }
-
-  hash_table_put (dl_url_file_map, xstrdup (url), xstrdup (file));
+     dl_url_file_map, so the mapping is replaced.  */
+  hash_table_put (dl_url_file_map, INTERN_TO_PTR (url_id),
+                  INTERN_TO_PTR (file_id));
 }
 
 /* Register that FROM has been redirected to "TO".  This assumes that TO
@@ -977,14 +1583,25 @@ register_download (const char *url, const char *file)
 void
 register_redirection (const char *from, const char *to)
 {
-  char *file;
+  intern_id file_id, from_id;
 
   ENSURE_TABLES_EXIST;
 
-  file = hash_table_get (dl_url_file_map, to);
-  assert (file != NULL);
-  if (!hash_table_contains (dl_url_file_map, from))
-    hash_table_put (dl_url_file_map, xstrdup (from), xstrdup (file));
+  file_id = map_get (dl_url_file_map, intern_lookup (to));
+  assert (file_id != 0);
+  from_id = intern (from);
+  if (!hash_table_contains (dl_url_file_map, INTERN_TO_PTR (from_id)))
+    hash_table_put (dl_url_file_map, INTERN_TO_PTR (from_id),
+                    INTERN_TO_PTR (file_id));
+}
+
+/* Return the id of the file URL has been downloaded to, or 0 if it
+   hasn't been downloaded.  URL is an interned id, possibly 0.  */
+
+intern_id
+downloaded_url_file (intern_id url)
+{
+  return map_get (dl_url_file_map, url);
 }
 
 /* Register that the file has been deleted. */
@@ -992,17 +1609,17 @@ register_redirection (const char *from, const char *to)
 void
 register_delete_file (const char *file)
 {
-  char *old_url, *old_file;
+  intern_id file_id;
 
   ENSURE_TABLES_EXIST;
 
-  if (!hash_table_get_pair (dl_file_url_map, file, &old_file, &old_url))
+  file_id = intern_lookup (file);
+  if (!file_id
+      || !hash_table_contains (dl_file_url_map, INTERN_TO_PTR (file_id)))
     return;
 
-  hash_table_remove (dl_file_url_map, file);
-  xfree (old_file);
-  xfree (old_url);
-  dissociate_urls_from_file (file);
+  hash_table_remove (dl_file_url_map, INTERN_TO_PTR (file_id));
+  dissociate_urls_from_file (file_id);
 }
 
 /* Register that FILE is an HTML file that has been downloaded. */
@@ -1035,13 +1652,11 @@ convert_cleanup (void)
 {
   if (dl_file_url_map)
     {
-      free_keys_and_values (dl_file_url_map);
       hash_table_destroy (dl_file_url_map);
       dl_file_url_map = NULL;
     }
   if (dl_url_file_map)
     {
-      free_keys_and_values (dl_url_file_map);
       hash_table_destroy (dl_url_file_map);
       dl_url_file_map = NULL;
     }
@@ -1052,6 +1667,11 @@ convert_cleanup (void)
   downloaded_files_free ();
   if (converted_files)
     string_set_free (converted_files);
+  if (early_files)
+    {
+      hash_table_destroy (early_files);
+      early_files = NULL;
+    }
 }
 #endif
 
@@ -1112,6 +1732,7 @@ downloaded_file_t
 downloaded_file (downloaded_file_t mode, const char *file)
 {
   downloaded_file_t *ptr;
+  unsigned long hash;
 
   if (mode == CHECK_FOR_FILE)
     {
@@ -1123,15 +1744,20 @@ downloaded_file (downloaded_file_t mode, const char *file)
       return *ptr;
     }
 
+  /* The file has been written anew; forget its early conversion.  */
+  if (early_files)
+    hash_table_remove (early_files, INTERN_TO_PTR (intern_lookup (file)));
+
   if (!downloaded_files_hash)
     downloaded_files_hash = make_string_hash_table (0);
 
-  ptr = hash_table_get (downloaded_files_hash, file);
+  hash = hash_string (file);
+  ptr = hash_table_get_hashed (downloaded_files_hash, file, hash);
   if (ptr)
     return *ptr;
 
   ptr = downloaded_mode_to_ptr (mode);
-  hash_table_put (downloaded_files_hash, xstrdup (file), ptr);
+  hash_table_put_hashed (downloaded_files_hash, xstrdup (file), ptr, hash);
 
   return FILE_NOT_ALREADY_DOWNLOADED;
 }
@@ -1153,6 +1779,150 @@ downloaded_files_free (void)
 }
 #endif
 
+/* Saving and restoring the download registry for --crawl-state: the
+   maps between URLs and files, the sets of HTML and CSS files, and the
+   downloaded files along with their modes.  Each table is written as
+   the number of its entries followed by the entries, using the
+   fput_* functions.  */
+
+static void
+save_id_map (FILE *fp, struct hash_table *map)
+{
+  hash_table_iterator iter;
+
+  fput_number (fp, map ? hash_table_count (map) : 0);
+  if (!map)
+    return;
+  for (hash_table_iterate (map, &iter); hash_table_iter_next (&iter); )
+    {
+      char *s = intern_strdup (PTR_TO_INTERN (iter.key));
+      fput_string (fp, s);
+      xfree (s);
+      s = intern_strdup (PTR_TO_INTERN (iter.value));
+      fput_string (fp, s);
+      xfree (s);
+    }
+}
+
+static void
+save_string_set (FILE *fp, struct hash_table *set)
+{
+  hash_table_iterator iter;
+
+  fput_number (fp, set ? hash_table_count (set) : 0);
+  if (!set)
+    return;
+  for (hash_table_iterate (set, &iter); hash_table_iter_next (&iter); )
+    fput_string (fp, iter.key);
+}
+
+void
+save_download_registry (FILE *fp)
+{
+  hash_table_iterator iter;
+
+  save_id_map (fp, dl_file_url_map);
+  save_id_map (fp, dl_url_file_map);
+  save_string_set (fp, downloaded_html_set);
+  save_string_set (fp, downloaded_css_set);
+
+  fput_number (fp, downloaded_files_hash
+               ? hash_table_count (downloaded_files_hash) : 0);
+  if (!downloaded_files_hash)
+    return;
+  for (hash_table_iterate (downloaded_files_hash, &iter);
+       hash_table_iter_next (&iter);
+       )
+    {
+      fput_string (fp, iter.key);
+      fput_number (fp, *(downloaded_file_t *) iter.value);
+    }
+}
+
+static bool
+load_id_map (FILE *fp, struct hash_table *map)
+{
+  unsigned long count;
+
+  if (!fget_number (fp, &count))
+    return false;
+  while (count--)
+    {
+      char *key, *value;
+
+      if (!fget_string (fp, &key) || !key)
+        return false;
+      if (!fget_string (fp, &value) || !value)
+        {
+          xfree (key);
+          return false;
+        }
+      hash_table_put (map, INTERN_TO_PTR (intern (key)),
+                      INTERN_TO_PTR (intern (value)));
+      xfree (key);
+      xfree (value);
+    }
+  return true;
+}
+
+static bool
+load_string_set (FILE *fp, struct hash_table **set)
+{
+  unsigned long count;
+
+  if (!fget_number (fp, &count))
+    return false;
+  while (count--)
+    {
+      char *s;
+
+      if (!fget_string (fp, &s) || !s)
+        return false;
+      if (!*set)
+        *set = make_string_hash_table (0);
+      string_set_add (*set, s);
+      xfree (s);
+    }
+  return true;
+}
+
+/* Add the registry written by save_download_registry to ours.
+   Returns false if FP doesn't hold a valid registry; what was read up
+   to that point is kept.  */
+
+bool
+load_download_registry (FILE *fp)
+{
+  unsigned long count;
+
+  ENSURE_TABLES_EXIST;
+
+  if (!load_id_map (fp, dl_file_url_map)
+      || !load_id_map (fp, dl_url_file_map)
+      || !load_string_set (fp, &downloaded_html_set)
+      || !load_string_set (fp, &downloaded_css_set)
+      || !fget_number (fp, &count))
+    return false;
+  while (count--)
+    {
+      char *file;
+      unsigned long mode;
+
+      if (!fget_string (fp, &file) || !file)
+        return false;
+      if (!fget_number (fp, &mode)
+          || (mode != FILE_DOWNLOADED_NORMALLY
+              && mode != FILE_DOWNLOADED_AND_HTML_EXTENSION_ADDED))
+        {
+          xfree (file);
+          return false;
+        }
+      downloaded_file (mode, file);
+      xfree (file);
+    }
+  return true;
+}
+
 /* The function returns the pointer to the malloc-ed quoted version of
    string s.  It will recognize and quote numeric and special graphic
    entities, as per RFC1866:
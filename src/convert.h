@@ -31,8 +31,9 @@ as that of the covered work.  */
 #ifndef CONVERT_H
 #define CONVERT_H
 
+#include "intern.h"
+
 struct hash_table;              /* forward decl */
-extern struct hash_table *dl_url_file_map;
 extern struct hash_table *downloaded_html_set;
 extern struct hash_table *downloaded_css_set;
 
@@ -44,10 +45,14 @@ enum convert_options {
                                    leaving the rest of the URL unchanged */
   CO_CONVERT_TO_COMPLETE,       /* convert to absolute, e.g. to
                                    "http://orighost/somedir/bar.jpg". */
-  CO_NULLIFY_BASE               /* change to empty string. */
+  CO_NULLIFY_BASE,              /* change to empty string. */
+  CO_PENDING                    /* not known yet, left for the end of
+                                   the retrieval (--convert-early);
+                                   local_name holds the URL to look up */
 };
 
 struct url;
+struct arena;
 
 /* A structure that defines the whereabouts of a URL, i.e. its
    position in an HTML document, etc.  */
@@ -107,6 +112,11 @@ void register_redirection (const char *, const char *);
 void register_html (const char *);
 void register_css (const char *);
 void register_delete_file (const char *);
+intern_id downloaded_url_file (intern_id);
+void save_download_registry (FILE *);
+bool load_download_registry (FILE *);
+void convert_links_early (const char *, struct urlpos *, struct arena *);
+bool converted_early (const char *);
 void convert_all_links (void);
 void convert_cleanup (void);
 
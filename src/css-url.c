@@ -53,15 +53,466 @@ as that of the covered work.  */
 #include "css-tokens.h"
 #include "css-url.h"
 #include "xstrndup.h"
+#include "c-strcase.h"
 
-/* from lex.yy.c */
-extern char *yytext;
-extern int yyleng;
-typedef struct yy_buffer_state *YY_BUFFER_STATE;
-extern YY_BUFFER_STATE yy_scan_bytes (const char *bytes,int len  );
-extern void yy_delete_buffer (YY_BUFFER_STATE  b);
-extern int yylex (void);
-extern void yylex_destroy(void);
+/* The scanner.
+
+   css_token finds the token at the start of the text and returns its
+   type and length.  It splits the text in the tokens of the CSS 2.1
+   grammar (see css-tokens.h), following the same longest-match rule
+   as the flex scanner that used to do this.  The exact type of most
+   tokens doesn't matter, though: only whitespace, strings, url() and
+   @import are of interest to get_urls_css, so the other tokens are
+   only delimited properly.
+
+   The scanner keeps no state between tokens and allocates nothing,
+   so any number of texts may be scanned at the same time, and a text
+   may be scanned in parts as it arrives, see get_urls_css_part.  */
+
+#define CSS_SPACE_P(c) ((c) == ' ' || (c) == '\t' || (c) == '\r'      \
+                        || (c) == '\n' || (c) == '\f')
+
+/* The characters above ASCII that may be part of names and URLs. */
+#define CSS_NONASCII_P(c) ((unsigned char) (c) >= 0240)
+
+/* The characters that may appear unescaped in url(...).  */
+#define CSS_URL_CHAR_P(c) ((c) == '!' || ((c) >= '#' && (c) <= '&')   \
+                           || ((c) >= '*' && (c) <= '~')                \
+                           || CSS_NONASCII_P (c))
+
+static const char *
+css_skip_space (const char *p, const char *end)
+{
+  while (p < end && CSS_SPACE_P (*p))
+    ++p;
+  return p;
+}
+
+/* Return the length of the escape sequence at P, such as `\26' or
+   `\"', or 0 if there is none.  */
+
+static int
+css_escape (const char *p, const char *end)
+{
+  const char *q = p + 1;
+
+  if (*p != '\\' || q >= end || *q == '\r' || *q == '\n' || *q == '\f')
+    return 0;
+  if (!c_isxdigit (*q))
+    return 2;
+
+  /* Up to six hex digits, optionally followed by a space.  */
+  while (q < end && q - p <= 6 && c_isxdigit (*q))
+    ++q;
+  if (q + 1 < end && q[0] == '\r' && q[1] == '\n')
+    q += 2;
+  else if (q < end && CSS_SPACE_P (*q))
+    ++q;
+  return q - p;
+}
+
+/* Skip the name characters at P.  */
+
+static const char *
+css_skip_name (const char *p, const char *end)
+{
+  int n;
+
+  while (p < end)
+    if (c_isalnum (*p) || *p == '_' || *p == '-' || CSS_NONASCII_P (*p))
+      ++p;
+    else if ((n = css_escape (p, end)) != 0)
+      p += n;
+    else
+      break;
+  return p;
+}
+
+/* Return the end of the identifier at P, or NULL if there is none.  */
+
+static const char *
+css_ident (const char *p, const char *end)
+{
+  int n;
+
+  if (p < end && *p == '-')
+    ++p;
+  if (p >= end)
+    return NULL;
+  if (c_isalpha (*p) || *p == '_' || CSS_NONASCII_P (*p))
+    ++p;
+  else if ((n = css_escape (p, end)) != 0)
+    p += n;
+  else
+    return NULL;
+  return css_skip_name (p, end);
+}
+
+/* Return the end of the string starting with the quote at P.  If the
+   closing quote is missing, that is where the string stops being one:
+   at the end of the line or of the text.  *COMPLETE tells which.  */
+
+static const char *
+css_string (const char *p, const char *end, bool *complete)
+{
+  char quote = *p++;
+
+  *complete = false;
+  while (p < end)
+    {
+      if (*p == quote)
+        {
+          *complete = true;
+          return p + 1;
+        }
+      if (*p == '\n' || *p == '\r' || *p == '\f')
+        break;
+      if (*p != '\\')
+        ++p;
+      else if (p + 1 == end)
+        return end;
+      else if (p[1] == '\r' && p + 2 < end && p[2] == '\n')
+        p += 3;                 /* escaped newline */
+      else if (p[1] == '\r' || p[1] == '\n' || p[1] == '\f')
+        p += 2;
+      else
+        p += css_escape (p, end);
+    }
+  return p;
+}
+
+/* Return the end of the comment at P, which starts with "/" "*", or
+   NULL if it isn't closed.  */
+
+static const char *
+css_comment (const char *p, const char *end)
+{
+  for (p += 2; p < end && (p = memchr (p, '*', end - p)) != NULL; p++)
+    if (p + 1 < end && p[1] == '/')
+      return p + 2;
+  return NULL;
+}
+
+/* Skip the spaces and comments at P, as between `!' and `important'.
+   A comment that isn't closed is not skipped; *UNCLOSED tells whether
+   there is one, if UNCLOSED is not NULL.  */
+
+static const char *
+css_skip_ignored (const char *p, const char *end, bool *unclosed)
+{
+  for (;;)
+    {
+      const char *q = css_skip_space (p, end);
+      const char *r;
+
+      if (q + 1 < end && q[0] == '/' && q[1] == '*')
+        {
+          if ((r = css_comment (q, end)) == NULL)
+            {
+              if (unclosed)
+                *unclosed = true;
+              return q;
+            }
+          p = r;
+        }
+      else if (q > p)
+        p = q;
+      else
+        return p;
+    }
+}
+
+/* Return the length of the letter C at P, which may be written in
+   either case, or escaped as in `\49' or `\i', or 0 if the letter is
+   not there.  */
+
+static int
+css_letter (const char *p, const char *end, char c)
+{
+  const char *q = p + 1;
+  int zeros = 0;
+
+  if (p >= end)
+    return 0;
+  if (c_tolower (*p) == c)
+    return 1;
+  if (*p != '\\' || q >= end)
+    return 0;
+
+  /* The letters that aren't hex digits may simply be escaped.  */
+  if (c_tolower (*q) == c && !strchr ("abcdef", c))
+    return 2;
+
+  /* Otherwise the escape must be the code of the letter, in upper or
+     lower case, with at most four leading zeros.  */
+  while (q < end && *q == '0' && zeros < 4)
+    ++q, ++zeros;
+  if (q + 1 >= end || !c_isxdigit (q[0]) || !c_isxdigit (q[1])
+      || (16 * _unhex (q[0]) + _unhex (q[1]) != c
+          && 16 * _unhex (q[0]) + _unhex (q[1]) != c_toupper (c)))
+    return 0;
+  q += 2;
+  if (q + 1 < end && q[0] == '\r' && q[1] == '\n')
+    q += 2;
+  else if (q < end && CSS_SPACE_P (*q))
+    ++q;
+  return q - p;
+}
+
+/* Return the length of the keyword WORD, in lower case, at P, or 0 if
+   it is not there.  */
+
+static int
+css_keyword (const char *p, const char *end, const char *word)
+{
+  const char *q = p;
+
+  for (; *word; word++)
+    {
+      int n = css_letter (q, end, *word);
+      if (!n)
+        return 0;
+      q += n;
+    }
+  return q - p;
+}
+
+/* Return the type of the token at P, which starts with "url(": a URI
+   if the parenthesis is closed, and a BAD_URI otherwise.  Store its
+   length to *LENGTH.  */
+
+static int
+css_url_token (const char *p, const char *end, int *length)
+{
+  const char *body = css_skip_space (p + 4, end);
+  const char *uri_end = NULL, *bad_end = body;
+  const char *q, *pos;
+  unsigned int uri_reach, bad_reach;
+  bool complete;
+
+  if (body < end && (*body == '"' || *body == '\''))
+    {
+      /* url("foo") */
+      q = css_string (body, end, &complete);
+      if (complete)
+        {
+          q = css_skip_space (q, end);
+          if (q < end && *q == ')')
+            uri_end = q + 1;
+        }
+      bad_end = q;
+    }
+
+  /* url(foo).  A backslash is a URL character of its own, but only an
+     escape may appear in a bad URL, so the two can end in different
+     places, as in url(a\)b).  Bit N of URI_REACH and BAD_REACH tells
+     whether the URL may go on at POS + N.  */
+  uri_reach = bad_reach = 1;
+  for (pos = body; (uri_reach | bad_reach) && pos <= end; pos++)
+    {
+      int n;
+
+      if ((uri_reach | bad_reach) & 1)
+        {
+          q = css_skip_space (pos, end);
+          if ((uri_reach & 1) && q < end && *q == ')'
+              && (!uri_end || q + 1 > uri_end))
+            uri_end = q + 1;
+          if ((bad_reach & 1) && q > bad_end)
+            bad_end = q;
+          if (pos == end)
+            break;
+          n = css_escape (pos, end);
+          if (uri_reach & 1)
+            {
+              if (CSS_URL_CHAR_P ((unsigned char) *pos))
+                uri_reach |= 2;
+              if (n)
+                uri_reach |= 1u << n;
+            }
+          if (bad_reach & 1)
+            {
+              if (*pos != '\\' && CSS_URL_CHAR_P ((unsigned char) *pos))
+                bad_reach |= 2;
+              if (n)
+                bad_reach |= 1u << n;
+            }
+        }
+      uri_reach >>= 1;
+      bad_reach >>= 1;
+    }
+
+  /* On a tie the URI wins, just as it would in flex.  */
+  if (uri_end && uri_end >= bad_end)
+    {
+      *length = uri_end - p;
+      return URI;
+    }
+  *length = bad_end - p;
+  return BAD_URI;
+}
+
+/* Find the token at *P.  *P is moved to the beginning of the token,
+   past text the CSS grammar ignores, and its length is stored to
+   *LENGTH.  Returns the type of the token, CSSEOF at the end of the
+   text, or the character itself for single characters.  */
+
+static int
+css_token (const char **p_ptr, const char *end, int *length)
+{
+  const char *p = *p_ptr;
+  const char *q;
+  int n;
+
+ again:
+  *p_ptr = p;
+  if (p >= end)
+    {
+      *length = 0;
+      return CSSEOF;
+    }
+
+  switch (*p)
+    {
+    case ' ': case '\t': case '\r': case '\n': case '\f':
+      *length = css_skip_space (p, end) - p;
+      return S;
+
+    case '/':
+      if (p + 1 < end && p[1] == '*')
+        {
+          q = css_comment (p, end);
+          if (!q)
+            /* An unclosed comment runs to the end of the text.  */
+            return *p_ptr = end, *length = 0, CSSEOF;
+          *length = q - p;
+          return COMMENT;
+        }
+      break;
+
+    case '"': case '\'':
+      {
+        bool complete;
+        *length = css_string (p, end, &complete) - p;
+        return complete ? STRING : BAD_STRING;
+      }
+
+    case '#':
+      if (p + 2 < end && p[1] == '/' && p[2] == '*'
+          && (q = css_comment (p + 1, end)) != NULL)
+        {
+          /* Ignored, like a comment.  */
+          p = q;
+          goto again;
+        }
+      q = css_skip_name (p + 1, end);
+      if (q > p + 1)
+        {
+          *length = q - p;
+          return HASH;
+        }
+      break;
+
+    case '@':
+      if ((n = css_keyword (p + 1, end, "import")) != 0)
+        return *length = n + 1, IMPORT_SYM;
+      if ((n = css_keyword (p + 1, end, "page")) != 0)
+        return *length = n + 1, PAGE_SYM;
+      if ((n = css_keyword (p + 1, end, "media")) != 0)
+        return *length = n + 1, MEDIA_SYM;
+      if (end - p >= 9 && 0 == c_strncasecmp (p, "@charset ", 9))
+        return *length = 9, CHARSET_SYM;
+      break;
+
+    case '!':
+      q = css_skip_ignored (p + 1, end, NULL);
+      if ((n = css_keyword (q, end, "important")) != 0)
+        return *length = q + n - p, IMPORTANT_SYM;
+      break;
+
+    case '<':
+      if (end - p >= 4 && 0 == memcmp (p, "<!--", 4))
+        return *length = 4, CDO;
+      break;
+
+    case '-':
+      if (end - p >= 3 && 0 == memcmp (p, "-->", 3))
+        return *length = 3, CDC;
+      break;
+
+    case '~': case '|':
+      if (p + 1 < end && p[1] == '=')
+        return *length = 2, *p == '~' ? INCLUDES : DASHMATCH;
+      break;
+
+    case 'u': case 'U':
+      if (end - p >= 4 && 0 == c_strncasecmp (p, "url(", 4))
+        return css_url_token (p, end, length);
+      break;
+    }
+
+  /* Numbers, with their units.  */
+  if (c_isdigit (*p) || (*p == '.' && p + 1 < end && c_isdigit (p[1])))
+    {
+      for (q = p; q < end && c_isdigit (*q); q++)
+        ;
+      if (q + 1 < end && *q == '.' && c_isdigit (q[1]))
+        for (q++; q < end && c_isdigit (*q); q++)
+          ;
+      if (q < end && *q == '%')
+        ++q;
+      else
+        {
+          const char *unit = css_ident (q, end);
+          if (unit)
+            q = unit;
+        }
+      *length = q - p;
+      return NUMBER;
+    }
+
+  /* Identifiers and functions.  */
+  if ((q = css_ident (p, end)) != NULL)
+    {
+      if (q < end && *q == '(')
+        return *length = q + 1 - p, FUNCTION;
+      *length = q - p;
+      return IDENT;
+    }
+
+  *length = 1;
+  return (unsigned char) *p;
+}
+
+/* How far css_token may look past the end of a token, at most: the
+   escapes in the keyword `important' after a `!', or in `import' after
+   a `@', are the furthest it goes.  */
+#define CSS_LOOKAHEAD 128
+
+/* Return whether the token found at P by css_token, of type TOKEN and
+   LENGTH, would still be the same if the text went on past END.  */
+
+static bool
+css_token_final (const char *p, const char *end, int token, int length)
+{
+  bool unclosed = false;
+
+  /* Either the end, or an unclosed comment that runs up to it.  */
+  if (token == CSSEOF)
+    return false;
+
+  if (*p == '!')
+    {
+      /* css_token looks for `important' past any spaces and comments,
+         however long.  */
+      const char *q = css_skip_ignored (p + 1, end, &unclosed);
+      return !unclosed && end - q >= CSS_LOOKAHEAD;
+    }
+  if (*p == '#' && end - p >= 3 && p[1] == '/' && p[2] == '*')
+    /* A comment after `#' would have been skipped if it were closed. */
+    return false;
+  return end - (p + length) >= CSS_LOOKAHEAD;
+}
 
 /*
   Given a detected URI token, get only the URI specified within.
@@ -111,38 +562,54 @@ get_uri_string (const char *at, int *pos, int *length)
   return xstrndup (at + *pos, *length);
 }
 
-void
-get_urls_css (struct map_context *ctx, int offset, int buf_length)
+/* Find the URLs in the CSS text of BUF_LENGTH characters at OFFSET
+   in CTX->text, and append them to CTX.
+
+   If COMPLETE is false, the text goes on past BUF_LENGTH, but has yet
+   to arrive.  The tokens that might then turn out differently are
+   left alone, and the function returns how much of the text has been
+   dealt with, so that the rest can be given again later along with
+   what follows.  */
+
+int
+get_urls_css_part (struct map_context *ctx, int offset, int buf_length,
+                   bool complete)
 {
-  int token;
-  /*char tmp[2048];*/
-  int buffer_pos = 0;
+  const char *text = ctx->text + offset;
+  const char *end = text + buf_length;
+  const char *p = text;
+  const char *statement;
+  int token, token_length;
   int pos, length;
   char *uri;
-  YY_BUFFER_STATE b;
-
-  /* tell flex to scan from this buffer */
-  b = yy_scan_bytes (ctx->text + offset, buf_length);
 
-  while((token = yylex()) != CSSEOF)
+  for (;;)
     {
-      /*DEBUGP (("%s ", token_names[token]));*/
+      /* The tokens from STATEMENT on are only acted upon once they
+         have all been found.  */
+      statement = p;
+      token = css_token (&p, end, &token_length);
+      if (!complete && !css_token_final (p, end, token, token_length))
+        return statement - text;
+      if (token == CSSEOF)
+        break;
+
       /* @import "foo.css"
          or @import url(foo.css)
       */
-      if(token == IMPORT_SYM)
+      if (token == IMPORT_SYM)
         {
           do {
-            buffer_pos += yyleng;
-          } while((token = yylex()) == S);
-
-          /*DEBUGP (("%s ", token_names[token]));*/
+            p += token_length;
+            token = css_token (&p, end, &token_length);
+            if (!complete && !css_token_final (p, end, token, token_length))
+              return statement - text;
+          } while (token == S);
 
           if (token == STRING || token == URI)
             {
-              /*DEBUGP (("Got URI "));*/
-              pos = buffer_pos + offset;
-              length = yyleng;
+              pos = p - ctx->text;
+              length = token_length;
 
               if (token == URI)
                 {
@@ -154,7 +621,7 @@ get_urls_css (struct map_context *ctx, int offset, int buf_length)
                   pos++;
                   length -= 2;
                   uri = xmalloc (length + 1);
-                  memcpy (uri, yytext + 1, length);
+                  memcpy (uri, p + 1, length);
                   uri[length] = '\0';
                 }
               else
@@ -163,7 +630,8 @@ get_urls_css (struct map_context *ctx, int offset, int buf_length)
               if (uri)
                 {
                   struct urlpos *up = append_url (uri, pos, length, ctx);
-                  DEBUGP (("Found @import: [%s] at %d [%s]\n", yytext, buffer_pos, uri));
+                  DEBUGP (("Found @import: [%.*s] at %d [%s]\n",
+                           token_length, p, (int) (p - text), uri));
 
                   if (up)
                     {
@@ -182,14 +650,15 @@ get_urls_css (struct map_context *ctx, int offset, int buf_length)
       */
       else if(token == URI)
         {
-          pos = buffer_pos + offset;
-          length = yyleng;
+          pos = p - ctx->text;
+          length = token_length;
           uri = get_uri_string (ctx->text, &pos, &length);
 
           if (uri)
             {
               struct urlpos *up = append_url (uri, pos, length, ctx);
-              DEBUGP (("Found URI: [%s] at %d [%s]\n", yytext, buffer_pos, uri));
+              DEBUGP (("Found URI: [%.*s] at %d [%s]\n",
+                       token_length, p, (int) (p - text), uri));
               if (up)
                 {
                   up->link_inline_p = 1;
@@ -199,20 +668,32 @@ get_urls_css (struct map_context *ctx, int offset, int buf_length)
               xfree (uri);
             }
         }
-      buffer_pos += yyleng;
+      p += token_length;
     }
 
-  yy_delete_buffer(b);
-  yylex_destroy();
-
   DEBUGP (("\n"));
+  return buf_length;
+}
+
+void
+get_urls_css (struct map_context *ctx, int offset, int buf_length)
+{
+  get_urls_css_part (ctx, offset, buf_length, true);
 }
 
+/* Like get_urls_html, for CSS.  */
+
 struct urlpos *
-get_urls_css_file (const char *file, const char *url)
+get_urls_css_file (const char *file, const char *url, struct arena *arena)
 {
   struct file_memory *fm;
   struct map_context ctx;
+  struct urlpos *urls;
+
+  /* If the file has just been downloaded, it has been parsed
+     already.  */
+  if (url && links_stream_take (file, url, true, arena, &urls, NULL, NULL))
+    return urls;
 
   /* Load the file. */
   fm = wget_read_file (file);
@@ -224,11 +705,13 @@ get_urls_css_file (const char *file, const char *url)
   DEBUGP (("Loaded %s (size %s).\n", file, number_to_static_string (fm->length)));
 
   ctx.text = fm->content;
-  ctx.head = NULL;
+  ctx.text_offset = 0;
+  ctx.head = ctx.tail = NULL;
   ctx.base = NULL;
   ctx.parent_base = url ? url : opt.base_href;
   ctx.document_file = file;
   ctx.nofollow = 0;
+  ctx.arena = arena;
 
   get_urls_css (&ctx, 0, fm->length);
   wget_read_file_free (fm);
@@ -32,6 +32,7 @@ as that of the covered work.  */
 #define CSS_URL_H
 
 void get_urls_css (struct map_context *, int, int);
-struct urlpos *get_urls_css_file (const char *, const char *);
+int get_urls_css_part (struct map_context *, int, int, bool);
+struct urlpos *get_urls_css_file (const char *, const char *, struct arena *);
 
 #endif /* CSS_URL_H */
@@ -440,6 +440,13 @@ wgnutls_poll (int fd, double timeout, int wait_for, void *arg)
   return select_fd (fd, timeout, wait_for);
 }
 
+static int
+wgnutls_pending (int fd _GL_UNUSED, void *arg)
+{
+  struct wgnutls_transport_context *ctx = arg;
+  return ctx->peeklen + gnutls_record_check_pending (ctx->session);
+}
+
 static int
 wgnutls_peek (int fd, char *buf, int bufsize, void *arg, double timeout)
 {
@@ -522,7 +529,8 @@ wgnutls_close (int fd, void *arg)
 static struct transport_implementation wgnutls_transport =
 {
   wgnutls_read, wgnutls_write, wgnutls_poll,
-  wgnutls_peek, wgnutls_errstr, wgnutls_close
+  wgnutls_peek, wgnutls_errstr, wgnutls_close,
+  wgnutls_pending
 };
 
 static int
@@ -41,8 +41,14 @@ void *hash_table_get (const struct hash_table *, const void *);
 int hash_table_get_pair (const struct hash_table *, const void *,
                          void *, void *);
 int hash_table_contains (const struct hash_table *, const void *);
+void *hash_table_get_hashed (const struct hash_table *, const void *,
+                             unsigned long);
+int hash_table_contains_hashed (const struct hash_table *, const void *,
+                                unsigned long);
 
 void hash_table_put (struct hash_table *, const void *, const void *);
+void hash_table_put_hashed (struct hash_table *, const void *, const void *,
+                            unsigned long);
 int hash_table_remove (struct hash_table *, const void *);
 void hash_table_clear (struct hash_table *);
 
@@ -61,6 +67,8 @@ int hash_table_count (const struct hash_table *);
 struct hash_table *make_string_hash_table (int);
 struct hash_table *make_nocase_string_hash_table (int);
 
+unsigned long hash_string (const void *);
+unsigned long hash_string_nocase (const void *);
 unsigned long hash_pointer (const void *);
 
 #endif /* HASH_H */
@@ -55,6 +55,10 @@ as that of the covered work.  */
 #endif /* WINDOWS */
 
 #include <errno.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <unistd.h>
 
 #include "utils.h"
 #include "host.h"
@@ -62,6 +66,15 @@ as that of the covered work.  */
 #include "hash.h"
 #include "ptimer.h"
 
+/* Background lookups need both threads and a resolver that is safe
+   to call from them.  */
+#if defined ENABLE_IPV6 && defined USE_POSIX_THREADS \
+  && !defined HAVE_LIBCARES
+# define ENABLE_DNS_PREFETCH
+# include <pthread.h>
+# include <signal.h>
+#endif
+
 #ifndef NO_ADDRESS
 # define NO_ADDRESS NO_DATA
 #endif
@@ -576,14 +589,127 @@ is_valid_ipv6_address (const char *str, const char *end)
   return true;
 }
 
-/* Simple host cache, used by lookup_host to speed up resolving.  The
-   cache doesn't handle TTL because Wget is a fairly short-lived
-   application.  Refreshing is attempted when connect fails, though --
-   see connect_to_host.  */
+/* Simple host cache, used by lookup_host to speed up resolving.
+   getaddrinfo doesn't report the TTL of the records it returns, so
+   a lookup is considered fresh for opt.dns_cache_ttl seconds.  At
+   most opt.dns_cache_size hosts are cached; when the cache is full,
+   the least recently used host is evicted.  Refreshing is also
+   attempted when connect fails -- see connect_to_host.
+
+   With --dns-cache-file, the cache is read from a file on first use
+   and written back by host_cache_save, so that the following
+   invocations of Wget can skip the lookups altogether.  */
+
+struct cache_entry {
+  char *host;                   /* the host name, lower-cased */
+  struct address_list *al;      /* the addresses HOST resolved to */
+  time_t expires;               /* when the lookup goes stale, or 0 */
+  struct cache_entry *prev;     /* the entry used more recently */
+  struct cache_entry *next;     /* the entry used less recently */
+};
 
-/* Mapping between known hosts and to lists of their addresses. */
+/* Mapping between known hosts and their cache entries. */
 static struct hash_table *host_name_addresses_map;
 
+/* The cache entries, the most recently used first. */
+static struct cache_entry *cache_head, *cache_tail;
+static int cache_count;
+
+/* Whether the cache file has been read, and whether the cache has
+   changed since.  */
+static bool cache_file_read;
+static bool cache_changed;
+
+static void cache_read_file (void);
+
+static void
+cache_unlink (struct cache_entry *e)
+{
+  if (e->prev)
+    e->prev->next = e->next;
+  else
+    cache_head = e->next;
+  if (e->next)
+    e->next->prev = e->prev;
+  else
+    cache_tail = e->prev;
+  e->prev = e->next = NULL;
+}
+
+static void
+cache_link_first (struct cache_entry *e)
+{
+  e->prev = NULL;
+  e->next = cache_head;
+  if (cache_head)
+    cache_head->prev = e;
+  else
+    cache_tail = e;
+  cache_head = e;
+}
+
+/* Remove the entry E from the cache and free it. */
+
+static void
+cache_drop (struct cache_entry *e)
+{
+  cache_unlink (e);
+  hash_table_remove (host_name_addresses_map, e->host);
+  address_list_release (e->al);
+  xfree (e->host);
+  xfree (e);
+  --cache_count;
+  cache_changed = true;
+}
+
+/* Add AL, the addresses of HOST, to the cache, to expire at EXPIRES.
+   If RECENT is false, the entry is considered the least recently
+   used, and is not added at all if the cache is full, in which case
+   false is returned.  */
+
+static bool
+cache_insert (const char *host, struct address_list *al, time_t expires,
+              bool recent)
+{
+  struct cache_entry *e;
+
+  if (!host_name_addresses_map)
+    host_name_addresses_map = make_nocase_string_hash_table (0);
+  if (!recent && opt.dns_cache_size > 0 && cache_count >= opt.dns_cache_size)
+    return false;
+
+  e = hash_table_get (host_name_addresses_map, host);
+  if (e)
+    cache_drop (e);
+
+  e = xnew0 (struct cache_entry);
+  e->host = xstrdup_lower (host);
+  e->al = al;
+  e->expires = expires;
+  ++al->refcount;
+  hash_table_put (host_name_addresses_map, e->host, e);
+  if (recent)
+    cache_link_first (e);
+  else
+    {
+      e->prev = cache_tail;
+      if (cache_tail)
+        cache_tail->next = e;
+      else
+        cache_head = e;
+      cache_tail = e;
+    }
+  ++cache_count;
+  cache_changed = true;
+
+  while (opt.dns_cache_size > 0 && cache_count > opt.dns_cache_size)
+    {
+      DEBUGP (("Evicting %s from host_name_addresses_map.\n",
+               cache_tail->host));
+      cache_drop (cache_tail);
+    }
+  return true;
+}
 
 /* Return the host's resolved addresses from the cache, if
    available.  */
@@ -591,17 +717,31 @@ static struct hash_table *host_name_addresses_map;
 static struct address_list *
 cache_query (const char *host)
 {
-  struct address_list *al;
+  struct cache_entry *e;
+
+  if (!cache_file_read)
+    cache_read_file ();
   if (!host_name_addresses_map)
     return NULL;
-  al = hash_table_get (host_name_addresses_map, host);
-  if (al)
+  e = hash_table_get (host_name_addresses_map, host);
+  if (!e)
+    return NULL;
+
+  if (e->expires && time (NULL) >= e->expires)
     {
-      DEBUGP (("Found %s in host_name_addresses_map (%p)\n", host, (void *) al));
-      ++al->refcount;
-      return al;
+      DEBUGP (("Cached addresses of %s have expired.\n", host));
+      cache_drop (e);
+      return NULL;
     }
-  return NULL;
+
+  DEBUGP (("Found %s in host_name_addresses_map (%p)\n", host, (void *) e->al));
+  if (e != cache_head)
+    {
+      cache_unlink (e);
+      cache_link_first (e);
+    }
+  ++e->al->refcount;
+  return e->al;
 }
 
 /* Cache the DNS lookup of HOST.  Subsequent invocations of
@@ -610,11 +750,13 @@ cache_query (const char *host)
 static void
 cache_store (const char *host, struct address_list *al)
 {
-  if (!host_name_addresses_map)
-    host_name_addresses_map = make_nocase_string_hash_table (0);
+  time_t expires = 0;
 
-  ++al->refcount;
-  hash_table_put (host_name_addresses_map, xstrdup_lower (host), al);
+  if (!cache_file_read)
+    cache_read_file ();
+  if (opt.dns_cache_ttl > 0)
+    expires = time (NULL) + (time_t) opt.dns_cache_ttl;
+  cache_insert (host, al, expires, true);
 
   IF_DEBUG
     {
@@ -632,17 +774,466 @@ cache_store (const char *host, struct address_list *al)
 static void
 cache_remove (const char *host)
 {
-  struct address_list *al;
+  struct cache_entry *e;
   if (!host_name_addresses_map)
     return;
-  al = hash_table_get (host_name_addresses_map, host);
-  if (al)
+  e = hash_table_get (host_name_addresses_map, host);
+  if (e)
+    cache_drop (e);
+}
+
+/* Read the cache entries stored in FP, skipping the expired ones.  If
+   MERGE is true, the hosts already in the cache are skipped too, and
+   the entries read are considered the least recently used.
+
+   Each line of the file holds a host name, the time its lookup
+   expires (0 if it never does), and its addresses, separated by
+   white space.  */
+
+static void
+cache_read (FILE *fp, bool merge)
+{
+  char *line = NULL;
+  size_t len = 0;
+  time_t now = time (NULL);
+
+  while (getline (&line, &len, fp) > 0)
+    {
+      char host[256], addr[64];
+      unsigned long expires;
+      struct address_list *al;
+      char *p;
+      int n;
+
+      for (p = line; c_isspace (*p); p++)
+        ;
+      if (*p == '#'
+          || sscanf (p, "%255s %lu%n", host, &expires, &n) != 2
+          || (expires && (time_t) expires <= now)
+          || (merge && host_name_addresses_map
+              && hash_table_contains (host_name_addresses_map, host)))
+        continue;
+
+      al = xnew0 (struct address_list);
+      for (p += n; sscanf (p, "%63s%n", addr, &n) == 1; p += n)
+        {
+          ip_address ip;
+
+          xzero (ip);
+          if (inet_pton (AF_INET, addr, &ip.data.d4) == 1)
+            ip.family = AF_INET;
+#ifdef ENABLE_IPV6
+          else if (inet_pton (AF_INET6, addr, &ip.data.d6) == 1)
+            ip.family = AF_INET6;
+#endif
+          else
+            continue;
+          al->addresses = xrealloc (al->addresses,
+                                    (al->count + 1) * sizeof (ip_address));
+          al->addresses[al->count++] = ip;
+        }
+
+      if (!al->count || !cache_insert (host, al, (time_t) expires, !merge))
+        address_list_delete (al);
+    }
+
+  xfree (line);
+}
+
+/* Read the cache file, if there is one, into the cache.  */
+
+static void
+cache_read_file (void)
+{
+  struct stat st;
+  FILE *fp;
+
+  cache_file_read = true;
+  if (!opt.dns_cache_file || !opt.dns_cache)
+    return;
+
+  /* Don't trust addresses others can write.  */
+  if (stat (opt.dns_cache_file, &st) != 0
+      || !S_ISREG (st.st_mode)
+#ifndef WINDOWS
+      || (st.st_mode & S_IWOTH)
+#endif
+      )
+    return;
+
+  fp = fopen (opt.dns_cache_file, "r");
+  if (!fp)
+    return;
+  DEBUGP (("Reading cached DNS lookups from %s\n", opt.dns_cache_file));
+  cache_read (fp, false);
+  fclose (fp);
+  cache_changed = false;
+}
+
+/* Write the DNS cache to opt.dns_cache_file, merging it with the
+   lookups other Wget processes have stored there meanwhile.  */
+
+void
+host_cache_save (void)
+{
+  struct cache_entry *e;
+  time_t now;
+  FILE *fp;
+
+  if (!opt.dns_cache_file || !opt.dns_cache || !cache_changed)
+    return;
+
+  fp = fopen (opt.dns_cache_file, "a+");
+  if (!fp)
+    {
+      logprintf (LOG_NOTQUIET, _("Cannot open %s: %s\n"),
+                 quote (opt.dns_cache_file), strerror (errno));
+      return;
+    }
+
+  /* Lock the file against the other Wget processes, and add their
+     lookups to ours before rewriting it.  */
+  flock (fileno (fp), LOCK_EX);
+  fseek (fp, 0, SEEK_SET);
+  cache_read (fp, true);
+  fseek (fp, 0, SEEK_SET);
+  if (ftruncate (fileno (fp), 0) != 0)
+    {
+      fclose (fp);
+      return;
+    }
+
+  DEBUGP (("Saving cached DNS lookups to %s\n", opt.dns_cache_file));
+  fputs ("# DNS cache for GNU Wget.\n", fp);
+  fputs ("# <hostname>\t<expires>\t<addresses>\n", fp);
+
+  /* Write the least recently used hosts first, so that reading the
+     file back restores the order.  Lists with scoped IPv6 addresses
+     are not written, as the scope is only meaningful locally.  */
+  now = time (NULL);
+  for (e = cache_tail; e; e = e->prev)
     {
-      address_list_release (al);
-      hash_table_remove (host_name_addresses_map, host);
+      int i;
+
+      if (e->expires && e->expires <= now)
+        continue;
+#if defined ENABLE_IPV6 && defined HAVE_SOCKADDR_IN6_SCOPE_ID
+      for (i = 0; i < e->al->count; i++)
+        if (e->al->addresses[i].family == AF_INET6
+            && e->al->addresses[i].ipv6_scope)
+          break;
+      if (i < e->al->count)
+        continue;
+#endif
+      fprintf (fp, "%s\t%lu", e->host, (unsigned long) e->expires);
+      for (i = 0; i < e->al->count; i++)
+        fprintf (fp, "\t%s", print_address (e->al->addresses + i));
+      fputc ('\n', fp);
     }
+
+  /* fclose unlocks the file.  */
+  if (fclose (fp) != 0)
+    logprintf (LOG_NOTQUIET, _("Cannot write to %s: %s\n"),
+               quote (opt.dns_cache_file), strerror (errno));
+  cache_changed = false;
 }
 
+/* Background lookups.  When a recursive download discovers links to
+   hosts it hasn't resolved yet, host_prefetch hands their names to a
+   few resolver threads, so that the addresses are already known, or
+   at least on their way, by the time the hosts are connected to.  The
+   threads do nothing but call getaddrinfo; lookup_host picks up the
+   results and caches them as if it had done the lookup itself.  */
+
+#ifdef ENABLE_DNS_PREFETCH
+
+/* The maximum number of resolver threads. */
+#define PREFETCH_THREADS 4
+
+/* The maximum number of lookups not yet taken by lookup_host.  Links
+   to hosts that are never downloaded from would otherwise pile up
+   their results without bound.  */
+#define PREFETCH_MAX 256
+
+struct prefetch {
+  char *host;                   /* the host being looked up */
+  bool done;                    /* whether the lookup has finished */
+  bool abandoned;               /* whether nobody will take the result */
+  int err;                      /* the result of getaddrinfo */
+  int sys_errno;                /* errno, for EAI_SYSTEM */
+  struct addrinfo *res;         /* the addresses getaddrinfo found */
+  struct prefetch *next;        /* next lookup in the queue */
+};
+
+/* PREFETCH_LOCK protects all the variables below. */
+static pthread_mutex_t prefetch_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Signaled when a lookup is queued, and when one finishes. */
+static pthread_cond_t prefetch_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t prefetch_finished = PTHREAD_COND_INITIALIZER;
+
+/* Mapping between host names and their lookups, both the queued and
+   the finished ones.  */
+static struct hash_table *prefetch_map;
+
+/* The lookups no thread has picked up yet. */
+static struct prefetch *prefetch_head, *prefetch_tail;
+
+/* The number of resolver threads started. */
+static int prefetch_threads;
+
+/* Set in a forked child, which doesn't inherit the threads. */
+static bool prefetch_disabled;
+
+static void *
+prefetch_thread (void *arg _GL_UNUSED)
+{
+  pthread_mutex_lock (&prefetch_lock);
+  for (;;)
+    {
+      struct prefetch *pf;
+      struct addrinfo hints, *res = NULL;
+      int err;
+
+      while (!prefetch_head)
+        pthread_cond_wait (&prefetch_queued, &prefetch_lock);
+      pf = prefetch_head;
+      prefetch_head = pf->next;
+      if (!prefetch_head)
+        prefetch_tail = NULL;
+      pthread_mutex_unlock (&prefetch_lock);
+
+      /* The same hints lookup_host uses for non-passive lookups. */
+      xzero (hints);
+      hints.ai_socktype = SOCK_STREAM;
+      if (opt.ipv4_only)
+        hints.ai_family = AF_INET;
+      else if (opt.ipv6_only)
+        hints.ai_family = AF_INET6;
+      else
+        hints.ai_family = AF_UNSPEC;
+
+      err = getaddrinfo (pf->host, NULL, &hints, &res);
+
+      pthread_mutex_lock (&prefetch_lock);
+      if (pf->abandoned)
+        {
+          /* host_prefetch_cancel has forgotten about this lookup.  */
+          if (res)
+            freeaddrinfo (res);
+          xfree (pf->host);
+          xfree (pf);
+          continue;
+        }
+      pf->err = err;
+      pf->sys_errno = errno;
+      pf->res = res;
+      pf->done = true;
+      pthread_cond_broadcast (&prefetch_finished);
+    }
+  return NULL;
+}
+
+/* Keep PREFETCH_LOCK consistent across fork: the child, which has no
+   resolver threads, must not wait for lookups that will never
+   finish.  */
+
+static void
+prefetch_atfork_prepare (void)
+{
+  pthread_mutex_lock (&prefetch_lock);
+}
+
+static void
+prefetch_atfork_parent (void)
+{
+  pthread_mutex_unlock (&prefetch_lock);
+}
+
+static void
+prefetch_atfork_child (void)
+{
+  prefetch_disabled = true;
+  pthread_mutex_unlock (&prefetch_lock);
+}
+
+/* Start looking up HOST in the background, unless it is numeric,
+   already known, or already being looked up.  */
+
+void
+host_prefetch (const char *host)
+{
+  const char *end = host + strlen (host);
+  struct prefetch *pf;
+
+  if (!opt.dns_cache
+      || is_valid_ipv4_address (host, end) || is_valid_ipv6_address (host, end)
+      || (host_name_addresses_map
+          && hash_table_contains (host_name_addresses_map, host)))
+    return;
+
+  pthread_mutex_lock (&prefetch_lock);
+  if (prefetch_disabled
+      || (prefetch_map
+          && (hash_table_count (prefetch_map) >= PREFETCH_MAX
+              || hash_table_contains (prefetch_map, host))))
+    {
+      pthread_mutex_unlock (&prefetch_lock);
+      return;
+    }
+  if (!prefetch_map)
+    {
+      prefetch_map = make_nocase_string_hash_table (0);
+      pthread_atfork (prefetch_atfork_prepare, prefetch_atfork_parent,
+                      prefetch_atfork_child);
+    }
+  if (prefetch_threads < PREFETCH_THREADS)
+    {
+      /* Block all signals in the new thread: SIGALRM in particular
+         must reach the main thread, whose run_with_timeout jumps out
+         of the signal handler.  */
+      sigset_t all, old;
+      pthread_t thread;
+
+      sigfillset (&all);
+      pthread_sigmask (SIG_SETMASK, &all, &old);
+      if (pthread_create (&thread, NULL, prefetch_thread, NULL) == 0)
+        {
+          pthread_detach (thread);
+          ++prefetch_threads;
+        }
+      pthread_sigmask (SIG_SETMASK, &old, NULL);
+      if (!prefetch_threads)
+        {
+          /* Nobody would ever do the lookup. */
+          pthread_mutex_unlock (&prefetch_lock);
+          return;
+        }
+    }
+
+  pf = xnew0 (struct prefetch);
+  pf->host = xstrdup_lower (host);
+  hash_table_put (prefetch_map, pf->host, pf);
+  if (prefetch_tail)
+    prefetch_tail->next = pf;
+  else
+    prefetch_head = pf;
+  prefetch_tail = pf;
+  pthread_cond_signal (&prefetch_queued);
+  pthread_mutex_unlock (&prefetch_lock);
+
+  DEBUGP (("Looking up %s in the background.\n", host));
+}
+
+/* If HOST has been looked up in the background, wait for the lookup
+   to finish, but no longer than TIMEOUT seconds unless TIMEOUT is 0,
+   and return true with the result of getaddrinfo in *ERR and *RES.
+   Otherwise return false, in which case the caller must look up HOST
+   itself.  */
+
+static bool
+prefetch_take (const char *host, double timeout, int *err,
+               struct addrinfo **res)
+{
+  struct prefetch *pf;
+
+  if (!prefetch_map)
+    return false;
+
+  pthread_mutex_lock (&prefetch_lock);
+  pf = hash_table_get (prefetch_map, host);
+  if (pf && !pf->done && !prefetch_disabled)
+    {
+      struct timespec deadline;
+
+      DEBUGP (("Waiting for the background lookup of %s.\n", host));
+      if (timeout)
+        {
+          clock_gettime (CLOCK_REALTIME, &deadline);
+          deadline.tv_sec += (time_t) timeout;
+          deadline.tv_nsec += (long) ((timeout - (time_t) timeout) * 1e9);
+          if (deadline.tv_nsec >= 1000000000)
+            {
+              ++deadline.tv_sec;
+              deadline.tv_nsec -= 1000000000;
+            }
+        }
+      while (!pf->done)
+        if ((timeout
+             ? pthread_cond_timedwait (&prefetch_finished, &prefetch_lock,
+                                       &deadline)
+             : pthread_cond_wait (&prefetch_finished, &prefetch_lock)) != 0)
+          break;
+    }
+  if (!pf || !pf->done)
+    {
+      pthread_mutex_unlock (&prefetch_lock);
+      return false;
+    }
+
+  hash_table_remove (prefetch_map, pf->host);
+  pthread_mutex_unlock (&prefetch_lock);
+
+  *err = pf->err;
+  *res = pf->res;
+  if (pf->err == EAI_SYSTEM)
+    errno = pf->sys_errno;
+  xfree (pf->host);
+  xfree (pf);
+  return true;
+}
+
+/* Forget the background lookups lookup_host hasn't taken, freeing
+   their results.  Those still in progress are left for their threads
+   to free when they finish.  */
+
+void
+host_prefetch_cancel (void)
+{
+  hash_table_iterator iter;
+
+  if (!prefetch_map)
+    return;
+
+  pthread_mutex_lock (&prefetch_lock);
+  for (hash_table_iterate (prefetch_map, &iter);
+       hash_table_iter_next (&iter); )
+    {
+      struct prefetch *pf = iter.value;
+      struct prefetch *queued;
+
+      for (queued = prefetch_head; queued; queued = queued->next)
+        if (queued == pf)
+          break;
+      if (!pf->done && !queued)
+        {
+          pf->abandoned = true;
+          continue;
+        }
+      if (pf->res)
+        freeaddrinfo (pf->res);
+      xfree (pf->host);
+      xfree (pf);
+    }
+  hash_table_clear (prefetch_map);
+  prefetch_head = prefetch_tail = NULL;
+  pthread_mutex_unlock (&prefetch_lock);
+}
+
+#else  /* not ENABLE_DNS_PREFETCH */
+
+void
+host_prefetch (const char *host _GL_UNUSED)
+{
+}
+
+void
+host_prefetch_cancel (void)
+{
+}
+
+#endif /* not ENABLE_DNS_PREFETCH */
+
 #ifdef HAVE_LIBCARES
 #include <sys/select.h>
 #include <ares.h>
@@ -907,7 +1498,11 @@ lookup_host (const char *host, int flags)
         }
 #endif
 
-      err = getaddrinfo_with_timeout (host, NULL, &hints, &res, timeout);
+#ifdef ENABLE_DNS_PREFETCH
+      if (!use_cache || (flags & LH_REFRESH)
+          || !prefetch_take (host, timeout, &err, &res))
+#endif
+        err = getaddrinfo_with_timeout (host, NULL, &hints, &res, timeout);
 
       if (err != 0 || res == NULL)
         {
@@ -1047,19 +1642,13 @@ sufmatch (const char **list, const char *what)
 void
 host_cleanup (void)
 {
+  while (cache_head)
+    {
+      assert (cache_head->al->refcount == 1);
+      cache_drop (cache_head);
+    }
   if (host_name_addresses_map)
     {
-      hash_table_iterator iter;
-      for (hash_table_iterate (host_name_addresses_map, &iter);
-           hash_table_iter_next (&iter);
-           )
-        {
-          char *host = iter.key;
-          struct address_list *al = iter.value;
-          xfree (host);
-          assert (al->refcount == 1);
-          address_list_delete (al);
-        }
       hash_table_destroy (host_name_addresses_map);
       host_name_addresses_map = NULL;
     }
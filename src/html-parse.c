@@ -87,7 +87,8 @@ as that of the covered work.  */
    its attributes.  */
 
 /* To test as standalone, compile with `-DSTANDALONE -I.'.  You'll
-   still need Wget headers to compile.  */
+   still need Wget headers to compile.  To time the parser on a
+   document read from stdin, also use -DBENCHMARK.  */
 
 #include "wget.h"
 
@@ -97,6 +98,7 @@ as that of the covered work.  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <assert.h>
 
@@ -272,18 +274,31 @@ struct pool {
    to "<foo", but "&lt,foo" to "<,foo".  */
 #define SKIP_SEMI(p, inc) (p += inc, p < end && *p == ';' ? ++p : p)
 
+/* The elements that have been opened and not yet closed.  The names
+   are copied, because the text they come from may be gone by the time
+   the end tag is seen when the document is parsed in parts.  */
+
 struct tagstack_item {
-  const char *tagname_begin;
-  const char *tagname_end;
-  const char *contents_begin;
+  int contents_begin;           /* position of the contents in the
+                                   document, or -1 if not known */
   struct tagstack_item *prev;
   struct tagstack_item *next;
+  int name_length;
+  char name[FLEXIBLE_ARRAY_MEMBER];
 };
 
 static struct tagstack_item *
-tagstack_push (struct tagstack_item **head, struct tagstack_item **tail)
+tagstack_push (struct tagstack_item **head, struct tagstack_item **tail,
+               const char *tagname_begin, const char *tagname_end)
 {
-  struct tagstack_item *ts = xmalloc(sizeof(struct tagstack_item));
+  int len = tagname_end - tagname_begin;
+  struct tagstack_item *ts =
+    xmalloc (offsetof (struct tagstack_item, name) + len + 1);
+
+  memcpy (ts->name, tagname_begin, len);
+  ts->name[len] = '\0';
+  ts->name_length = len;
+  ts->contents_begin = -1;
   if (*head == NULL)
     {
       *head = *tail = ts;
@@ -350,9 +365,9 @@ tagstack_find (struct tagstack_item *tail, const char *tagname_begin,
   int len = tagname_end - tagname_begin;
   while (tail)
     {
-      if (len == (tail->tagname_end - tail->tagname_begin))
+      if (len == tail->name_length)
         {
-          if (0 == strncasecmp (tail->tagname_begin, tagname_begin, len))
+          if (0 == strncasecmp (tail->name, tagname_begin, len))
             return tail;
         }
       tail = tail->prev;
@@ -558,10 +573,13 @@ static int comment_backout_count;
 
    Whitespace is allowed between and after the comments, but not
    before the first comment.  Additionally, this function attempts to
-   handle double quotes in SGML declarations correctly.  */
+   handle double quotes in SGML declarations correctly.
+
+   If MORE is true, END is not the end of the document, and NULL is
+   returned if the declaration runs into it.  */
 
 static const char *
-advance_declaration (const char *beg, const char *end)
+advance_declaration (const char *beg, const char *end, bool more)
 {
   const char *p = beg;
   char quote_char = '\0';       /* shut up, gcc! */
@@ -593,7 +611,11 @@ advance_declaration (const char *beg, const char *end)
   while (state != AC_S_DONE && state != AC_S_BACKOUT)
     {
       if (p == end)
-        state = AC_S_BACKOUT;
+        {
+          if (more)
+            return NULL;
+          state = AC_S_BACKOUT;
+        }
       switch (state)
         {
         case AC_S_DONE:
@@ -729,48 +751,43 @@ advance_declaration (const char *beg, const char *end)
 static const char *
 find_comment_end (const char *beg, const char *end)
 {
-  /* Open-coded Boyer-Moore search for "-->".  Examine the third char;
-     if it's not '>' or '-', advance by three characters.  Otherwise,
-     look at the preceding characters and try to find a match.  */
+  /* Look for each '>' with memchr, which goes through the text a word
+     or a vector register at a time, and check whether the two
+     preceding characters complete the "-->".  Comments rarely contain
+     '>', so this is faster than examining every third character for
+     a '-' or a '>'.  */
 
-  const char *p = beg - 1;
+  const char *p = beg + 2;
 
-  while ((p += 3) < end)
-    switch (p[0])
-      {
-      case '>':
-        if (p[-1] == '-' && p[-2] == '-')
-          return p + 1;
-        break;
-      case '-':
-      at_dash:
-        if (p[-1] == '-')
-          {
-          at_dash_dash:
-            if (++p == end) return NULL;
-            switch (p[0])
-              {
-              case '>': return p + 1;
-              case '-': goto at_dash_dash;
-              }
-          }
-        else
-          {
-            if ((p += 2) >= end) return NULL;
-            switch (p[0])
-              {
-              case '>':
-                if (p[-1] == '-')
-                  return p + 1;
-                break;
-              case '-':
-                goto at_dash;
-              }
-          }
-      }
+  while (p < end && (p = memchr (p, '>', end - p)) != NULL)
+    {
+      if (p[-1] == '-' && p[-2] == '-')
+        return p + 1;
+      ++p;
+    }
   return NULL;
 }
 
+/* Return the first of the characters C1, C2 and C3 to occur in [P,
+   END), or NULL if none does.  C1 is expected to be the nearest; the
+   search for each of the others then stops where the previous match
+   was found.  */
+
+static const char *
+find_first_of (const char *p, const char *end, char c1, char c2, char c3)
+{
+  const char *q, *match;
+
+  match = memchr (p, c1, end - p);
+  if (match)
+    end = match;
+  if ((q = memchr (p, c2, end - p)) != NULL)
+    end = match = q;
+  if ((q = memchr (p, c3, end - p)) != NULL)
+    match = q;
+  return match;
+}
+
 /* Return true if the string containing of characters inside [b, e) is
    present in hash table HT.  */
 
@@ -821,45 +838,56 @@ name_allowed (const struct hash_table *ht, const char *b, const char *e)
 static int tag_backout_count;
 #endif
 
-/* Map MAPFUN over HTML tags in TEXT, which is SIZE characters long.
-   MAPFUN will be called with two arguments: pointer to an initialized
-   struct taginfo, and MAPARG.
-
-   ALLOWED_TAGS and ALLOWED_ATTRIBUTES are hash tables the keys of
-   which are the tags and attribute names that this function should
-   use.  If ALLOWED_TAGS is NULL, all tags are processed; if
-   ALLOWED_ATTRIBUTES is NULL, all attributes are returned.
-
-   (Obviously, the caller can filter out unwanted tags and attributes
-   just as well, but this is just an optimization designed to avoid
-   unnecessary copying of tags/attributes which the caller doesn't
-   care about.)  */
-
-void
-map_html_tags (const char *text, int size,
-               void (*mapfun) (struct taginfo *, void *), void *maparg,
-               int flags,
-               const struct hash_table *allowed_tags,
-               const struct hash_table *allowed_attributes)
+/* Map PARSER->mapfun over the HTML tags in [TEXT + *START, TEXT +
+   SIZE).  TEXT holds a part of the document, which begins OFFSET
+   characters into it; *START is where the previous call for the
+   document left off, or 0.  The tag names and attributes are given
+   to the mapper in a struct taginfo, whose pointers point into TEXT.
+
+   If COMPLETE is true, TEXT goes on to the end of the document.  If
+   it is false, the rest of the document is yet to come, and a tag
+   that may continue past TEXT + SIZE is left for the next call.  The
+   tags are then found and mapped exactly as if the whole document
+   had been given at once.
+
+   *START is set to where the next call should begin, always at or
+   before TEXT + SIZE.  The return value tells how much of TEXT is
+   still needed: the text before *START, except for the contents of
+   the open elements named in PARSER->content_tags, which are given
+   to the mapper along with the end tag.  The contents of the other
+   elements are only given if they are still at hand.  */
+
+int
+map_html_tags_part (struct html_parser *parser, const char *text, int size,
+                    int offset, int *start, bool complete)
 {
   /* storage for strings passed to MAPFUN callback; if 256 bytes is
      too little, POOL_APPEND allocates more with malloc. */
   char pool_initial_storage[256];
   struct pool pool;
 
-  const char *p = text;
+  const char *p = text + *start;
   const char *end = text + size;
+  int flags = parser->flags;
+  const struct hash_table *allowed_tags = parser->allowed_tags;
+  const struct hash_table *allowed_attributes = parser->allowed_attributes;
+
+  /* Where the parsing can be taken up again without changing the
+     outcome, should END cut a tag short.  */
+  const char *resume = p;
+  /* The element opened by the tag being parsed, to be forgotten if
+     the tag is left for the next call.  */
+  struct tagstack_item *opened = NULL;
+  struct tagstack_item *ts;
+  int keep;
 
   struct attr_pair attr_pair_initial_storage[8];
   int attr_pair_size = countof (attr_pair_initial_storage);
   bool attr_pair_resized = false;
   struct attr_pair *pairs = attr_pair_initial_storage;
 
-  struct tagstack_item *head = NULL;
-  struct tagstack_item *tail = NULL;
-
-  if (!size)
-    return;
+  if (p == end)
+    goto done;
 
   POOL_INIT (&pool, pool_initial_storage, countof (pool_initial_storage));
 
@@ -874,20 +902,27 @@ map_html_tags (const char *text, int size,
 
     nattrs = 0;
     end_tag = 0;
+    opened = NULL;
 
     /* Find beginning of tag.  We use memchr() instead of the usual
        looping with ADVANCE() for speed. */
     p = memchr (p, '<', end - p);
     if (!p)
-      goto finish;
+      {
+        resume = end;
+        goto finish;
+      }
 
-    tag_start_position = p;
+    resume = tag_start_position = p;
     ADVANCE (p);
 
     /* Establish the type of the tag (start-tag, end-tag or
        declaration).  */
     if (*p == '!')
       {
+        if (!complete && !(flags & MHT_STRICT_COMMENTS) && p + 3 >= end)
+          /* Whether this is a comment is yet to be seen.  */
+          goto finish;
         if (!(flags & MHT_STRICT_COMMENTS)
             && p + 3 < end && p[1] == '-' && p[2] == '-')
           {
@@ -899,6 +934,8 @@ map_html_tags (const char *text, int size,
             const char *comment_end = find_comment_end (p + 3, end);
             if (comment_end)
               p = comment_end;
+            else if (!complete)
+              goto finish;
           }
         else
           {
@@ -906,8 +943,11 @@ map_html_tags (const char *text, int size,
                declaration.  Real declarations are much less likely to
                be misused the way comments are, so advance over them
                properly regardless of strictness.  */
-            p = advance_declaration (p, end);
+            p = advance_declaration (p, end, !complete);
+            if (!p)
+              goto finish;
           }
+        resume = p;
         if (p == end)
           goto finish;
         goto look_for_tag;
@@ -926,15 +966,8 @@ map_html_tags (const char *text, int size,
     SKIP_WS (p);
 
     if (!end_tag)
-      {
-        struct tagstack_item *ts = tagstack_push (&head, &tail);
-        if (ts)
-          {
-            ts->tagname_begin  = tag_name_begin;
-            ts->tagname_end    = tag_name_end;
-            ts->contents_begin = NULL;
-          }
-      }
+      opened = tagstack_push (&parser->head, &parser->tail,
+                              tag_name_begin, tag_name_end);
 
     if (end_tag && *p != '>' && *p != '<')
       goto backout_tag;
@@ -1005,31 +1038,27 @@ map_html_tags (const char *text, int size,
             SKIP_WS (p);
             if (*p == '\"' || *p == '\'')
               {
-                bool newline_seen = false;
+                const char *quote_end;
                 char quote_char = *p;
                 attr_raw_value_begin = p;
                 ADVANCE (p);
                 attr_value_begin = p; /* <foo bar="baz"> */
                                       /*           ^     */
-                while (*p != quote_char)
-                  {
-                    if (!newline_seen && *p == '\n')
-                      {
-                        /* If a newline is seen within the quotes, it
-                           is most likely that someone forgot to close
-                           the quote.  In that case, we back out to
-                           the value beginning, and terminate the tag
-                           at either `>' or the delimiter, whichever
-                           comes first.  Such a tag terminated at `>'
-                           is discarded.  */
-                        p = attr_value_begin;
-                        newline_seen = true;
-                        continue;
-                      }
-                    else if (newline_seen && (*p == '<' || *p == '>'))
-                      break;
-                    ADVANCE (p);
-                  }
+                /* Skip to the closing quote in one go; values can be
+                   long, as with data: URLs.  */
+                quote_end = memchr (p, quote_char, end - p);
+                if (memchr (p, '\n', (quote_end ? quote_end : end) - p))
+                  /* If a newline is seen within the quotes, it is
+                     most likely that someone forgot to close the
+                     quote.  In that case, we back out to the value
+                     beginning, and terminate the tag at either `>' or
+                     the delimiter, whichever comes first.  Such a tag
+                     terminated at `>' is discarded.  */
+                  quote_end = find_first_of (attr_value_begin, end,
+                                             '>', '<', quote_char);
+                if (!quote_end)
+                  goto finish;
+                p = quote_end;
                 attr_value_end = p; /* <foo bar="baz"> */
                                     /*              ^  */
                 if (*p == quote_char)
@@ -1098,10 +1127,13 @@ map_html_tags (const char *text, int size,
         ++nattrs;
       }
 
-    if (!end_tag && tail && (tail->tagname_begin == tag_name_begin))
-      {
-        tail->contents_begin = p+1;
-      }
+    if (opened)
+      opened->contents_begin = offset + (p + 1 - text);
+
+    /* The tag is complete; from here on, the parsing may resume
+       after it.  */
+    opened = NULL;
+    resume = p + 1;
 
     if (uninteresting_tag)
       {
@@ -1114,7 +1146,6 @@ map_html_tags (const char *text, int size,
     {
       int i;
       struct taginfo taginfo;
-      struct tagstack_item *ts = NULL;
 
       taginfo.name      = pool.contents;
       taginfo.end_tag_p = end_tag;
@@ -1136,19 +1167,20 @@ map_html_tags (const char *text, int size,
 
       if (end_tag)
         {
-          ts = tagstack_find (tail, tag_name_begin, tag_name_end);
+          ts = tagstack_find (parser->tail, tag_name_begin, tag_name_end);
           if (ts)
             {
-              if (ts->contents_begin)
+              if (ts->contents_begin >= offset)
                 {
-                  taginfo.contents_begin = ts->contents_begin;
+                  taginfo.contents_begin = text + (ts->contents_begin
+                                                   - offset);
                   taginfo.contents_end   = tag_start_position;
                 }
-              tagstack_pop (&head, &tail, ts);
+              tagstack_pop (&parser->head, &parser->tail, ts);
             }
         }
 
-      mapfun (&taginfo, maparg);
+      parser->mapfun (&taginfo, parser->maparg);
       if (*p != '<')
         ADVANCE (p);
     }
@@ -1160,6 +1192,7 @@ map_html_tags (const char *text, int size,
 #endif
     /* The tag wasn't really a tag.  Treat its contents as ordinary
        data characters. */
+    opened = NULL;
     p = tag_start_position + 1;
     goto look_for_tag;
   }
@@ -1168,8 +1201,63 @@ map_html_tags (const char *text, int size,
   POOL_FREE (&pool);
   if (attr_pair_resized)
     xfree (pairs);
+  /* A start tag left for the next call will be pushed again.  */
+  if (!complete && opened)
+    tagstack_pop (&parser->head, &parser->tail, opened);
+
+ done:
+  *start = complete ? size : resume - text;
+  keep = *start;
+  if (parser->content_tags)
+    for (ts = parser->head; ts; ts = ts->next)
+      if (ts->contents_begin >= 0 && ts->contents_begin - offset < keep
+          && hash_table_get (parser->content_tags, ts->name))
+        keep = ts->contents_begin - offset;
+  return keep;
+}
+
+/* Map MAPFUN over HTML tags in TEXT, which is SIZE characters long.
+   MAPFUN will be called with two arguments: pointer to an initialized
+   struct taginfo, and MAPARG.
+
+   ALLOWED_TAGS and ALLOWED_ATTRIBUTES are hash tables the keys of
+   which are the tags and attribute names that this function should
+   use.  If ALLOWED_TAGS is NULL, all tags are processed; if
+   ALLOWED_ATTRIBUTES is NULL, all attributes are returned.
+
+   (Obviously, the caller can filter out unwanted tags and attributes
+   just as well, but this is just an optimization designed to avoid
+   unnecessary copying of tags/attributes which the caller doesn't
+   care about.)  */
+
+void
+map_html_tags (const char *text, int size,
+               void (*mapfun) (struct taginfo *, void *), void *maparg,
+               int flags,
+               const struct hash_table *allowed_tags,
+               const struct hash_table *allowed_attributes)
+{
+  struct html_parser parser;
+  int start = 0;
+
+  xzero (parser);
+  parser.mapfun = mapfun;
+  parser.maparg = maparg;
+  parser.flags = flags;
+  parser.allowed_tags = allowed_tags;
+  parser.allowed_attributes = allowed_attributes;
+
+  map_html_tags_part (&parser, text, size, 0, &start, true);
+  html_parser_free (&parser);
+}
+
+/* Forget the elements PARSER has seen opened.  */
+
+void
+html_parser_free (struct html_parser *parser)
+{
   /* pop any tag stack that's left */
-  tagstack_pop (&head, &tail, head);
+  tagstack_pop (&parser->head, &parser->tail, parser->head);
 }
 
 #undef ADVANCE
@@ -1177,19 +1265,32 @@ map_html_tags (const char *text, int size,
 #undef SKIP_NON_WS
 
 #ifdef STANDALONE
+#ifndef BENCHMARK
+/* The text given to map_html_tags_part and its position in the
+   document, to print the positions of the tags.  */
+static const char *test_text;
+static int test_offset;
+
 static void
 test_mapper (struct taginfo *taginfo, void *arg)
 {
   int i;
 
-  printf ("%s%s", taginfo->end_tag_p ? "/" : "", taginfo->name);
+  printf ("%d: %s%s", test_offset + (int) (taginfo->start_position - test_text),
+          taginfo->end_tag_p ? "/" : "", taginfo->name);
   for (i = 0; i < taginfo->nattrs; i++)
     printf (" %s=%s", taginfo->attrs[i].name, taginfo->attrs[i].value);
+  if (taginfo->contents_begin)
+    printf (" (%d)", (int) (taginfo->contents_end - taginfo->contents_begin));
   putchar ('\n');
   ++*(int *)arg;
 }
 
-int main ()
+/* With an argument, the text is parsed in parts of that many
+   characters, as if it were being downloaded, and keeping only what
+   map_html_tags_part needs.  The output must be the same.  */
+
+int main (int argc, char **argv)
 {
   int size = 256;
   char *x = xmalloc (size);
@@ -1212,10 +1313,132 @@ int main ()
       x = xrealloc (x, size);
     }
 
-  map_html_tags (x, length, test_mapper, &tag_counter, 0, NULL, NULL);
+  if (argc > 1)
+    {
+      static struct hash_table all_tags;
+      struct html_parser parser;
+      int part = atoi (argv[1]);
+      char *buf = xmalloc (length + 1);
+      int buf_length = 0, start = 0, kept_max = 0, keep, i;
+
+      memset (&parser, 0, sizeof parser);
+      parser.mapfun = test_mapper;
+      parser.maparg = &tag_counter;
+      parser.content_tags = &all_tags;
+      test_text = buf;
+      for (i = 0; i < length; i += part)
+        {
+          int n = part < length - i ? part : length - i;
+          memcpy (buf + buf_length, x + i, n);
+          buf_length += n;
+          keep = map_html_tags_part (&parser, buf, buf_length, test_offset,
+                                     &start, false);
+          memmove (buf, buf + keep, buf_length - keep);
+          buf_length -= keep;
+          start -= keep;
+          test_offset += keep;
+          if (buf_length > kept_max)
+            kept_max = buf_length;
+        }
+      map_html_tags_part (&parser, buf, buf_length, test_offset, &start, true);
+      html_parser_free (&parser);
+      fprintf (stderr, "Kept at most: %d\n", kept_max);
+      xfree (buf);
+    }
+  else
+    {
+      test_text = x;
+      map_html_tags (x, length, test_mapper, &tag_counter, 0, NULL, NULL);
+    }
   printf ("TAGS: %d\n", tag_counter);
   printf ("Tag backouts:     %d\n", tag_backout_count);
   printf ("Comment backouts: %d\n", comment_backout_count);
+  xfree (x);
+  return 0;
+}
+
+#else  /* BENCHMARK */
+
+/* Parse the document on stdin over and over, as get_urls_html does
+   (all tags, trimmed values), at once and then in parts of 16K as it
+   would arrive from the network, and print the throughput.  */
+
+#include <time.h>
+
+static void
+count_mapper (struct taginfo *taginfo, void *arg)
+{
+  ++*(int *)arg;
+}
+
+static double
+now (void)
+{
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main (int argc, char **argv)
+{
+  int size = 256, length = 0, read_count, round, rounds;
+  int tags = 0, part = 16 * 1024;
+  char *x = xmalloc (size), *buf;
+  double start, whole_time, part_time;
+
+  while ((read_count = fread (x + length, 1, size - length, stdin)))
+    {
+      length += read_count;
+      size <<= 1;
+      x = xrealloc (x, size);
+    }
+  if (length == 0)
+    return 1;
+  /* About 100 MB in all.  */
+  rounds = argc > 1 ? atoi (argv[1]) : 1 + 100 * 1024 * 1024 / length;
+  buf = xmalloc (length);
+
+  start = now ();
+  for (round = 0; round < rounds; round++)
+    map_html_tags (x, length, count_mapper, &tags, MHT_TRIM_VALUES,
+                   NULL, NULL);
+  whole_time = now () - start;
+
+  start = now ();
+  for (round = 0; round < rounds; round++)
+    {
+      struct html_parser parser;
+      int buf_length = 0, offset = 0, parsed = 0, keep, i;
+
+      memset (&parser, 0, sizeof parser);
+      parser.mapfun = count_mapper;
+      parser.maparg = &tags;
+      parser.flags = MHT_TRIM_VALUES;
+      for (i = 0; i < length; i += part)
+        {
+          int n = part < length - i ? part : length - i;
+          memcpy (buf + buf_length, x + i, n);
+          buf_length += n;
+          keep = map_html_tags_part (&parser, buf, buf_length, offset,
+                                     &parsed, false);
+          memmove (buf, buf + keep, buf_length - keep);
+          buf_length -= keep;
+          parsed -= keep;
+          offset += keep;
+        }
+      map_html_tags_part (&parser, buf, buf_length, offset, &parsed, true);
+      html_parser_free (&parser);
+    }
+  part_time = now () - start;
+
+  printf ("%d bytes, %d tags, %d rounds\n", length, tags / rounds / 2,
+          rounds);
+  printf ("whole:    %.1f MB/s\n", (double) length * rounds / whole_time / 1e6);
+  printf ("in parts: %.1f MB/s\n", (double) length * rounds / part_time / 1e6);
+  xfree (buf);
+  xfree (x);
   return 0;
 }
+#endif /* BENCHMARK */
 #endif /* STANDALONE */
@@ -68,4 +68,24 @@ void map_html_tags (const char *, int,
                     void (*) (struct taginfo *, void *), void *, int,
                     const struct hash_table *, const struct hash_table *);
 
+/* The state of a document that is parsed in parts as it arrives, see
+   map_html_tags_part.  The fields up to content_tags are set by the
+   caller, after clearing the structure with xzero.  */
+struct html_parser {
+  void (*mapfun) (struct taginfo *, void *);
+  void *maparg;
+  int flags;                    /* MHT_* flags */
+  const struct hash_table *allowed_tags;
+  const struct hash_table *allowed_attributes;
+  const struct hash_table *content_tags; /* the elements whose contents
+                                            are needed, or NULL */
+
+  struct tagstack_item *head;   /* the elements that are open */
+  struct tagstack_item *tail;
+};
+
+int map_html_tags_part (struct html_parser *, const char *, int, int, int *,
+                        bool);
+void html_parser_free (struct html_parser *);
+
 #endif /* HTML_PARSE_H */
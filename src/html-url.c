@@ -190,6 +190,9 @@ static const char *additional_attributes[] = {
 static struct hash_table *interesting_tags;
 static struct hash_table *interesting_attributes;
 
+/* The elements whose contents collect_tags_mapper looks at. */
+static struct hash_table *interesting_contents;
+
 /* Will contains the (last) charset found in 'http-equiv=content-type'
    meta tags  */
 static char *meta_charset;
@@ -247,6 +250,9 @@ init_interesting (void)
   for (i = 0; i < countof (tag_url_attributes); i++)
     hash_table_put (interesting_attributes,
                     tag_url_attributes[i].attr_name, "1");
+
+  interesting_contents = make_nocase_string_hash_table (1);
+  hash_table_put (interesting_contents, "style", "1");
 }
 
 /* Find the value of attribute named NAME in the taginfo TAG.  If the
@@ -275,7 +281,8 @@ find_attr (struct taginfo *tag, const char *name, int *attrind)
 
 /* Append LINK_URI to the urlpos structure that is being built.
 
-   LINK_URI will be merged with the current document base.
+   LINK_URI will be merged with the current document base.  POSITION
+   is relative to CTX->text.
 */
 
 struct urlpos *
@@ -309,7 +316,7 @@ append_url (const char *link_uri, int position, int size,
           return NULL;
         }
 
-      url = url_parse (link_uri, NULL, iri, false);
+      url = url_parse_arena (link_uri, NULL, iri, false, ctx->arena);
       if (!url)
         {
           DEBUGP (("%s: link \"%s\" doesn't parse.\n",
@@ -332,7 +339,7 @@ append_url (const char *link_uri, int position, int size,
                quote_n (2, link_uri),
                quotearg_n_style (3, escape_quoting_style, complete_uri)));
 
-      url = url_parse (complete_uri, NULL, iri, false);
+      url = url_parse_arena (complete_uri, NULL, iri, false, ctx->arena);
       if (!url)
         {
           DEBUGP (("%s: merged link \"%s\" doesn't parse.\n",
@@ -348,9 +355,10 @@ append_url (const char *link_uri, int position, int size,
 
   DEBUGP (("appending %s to urlpos.\n", quote (url->url)));
 
-  newel = xnew0 (struct urlpos);
+  newel = arena_alloc (ctx->arena, sizeof *newel);
+  xzero (*newel);
   newel->url = url;
-  newel->pos = position;
+  newel->pos = position + ctx->text_offset;
   newel->size = size;
 
   /* A URL is relative if the host is not named, and the name does not
@@ -360,15 +368,21 @@ append_url (const char *link_uri, int position, int size,
   else if (link_has_scheme)
     newel->link_complete_p = 1;
 
-  /* Append the new URL maintaining the order by position.  */
+  /* Append the new URL maintaining the order by position.  Links
+     are mostly found in order, so check the end of the list first. */
   if (ctx->head == NULL)
-    ctx->head = newel;
+    ctx->head = ctx->tail = newel;
+  else if (newel->pos > ctx->tail->pos)
+    {
+      ctx->tail->next = newel;
+      ctx->tail = newel;
+    }
   else
     {
       struct urlpos *it, *prev = NULL;
 
       it = ctx->head;
-      while (it && position > it->pos)
+      while (it && newel->pos > it->pos)
         {
           prev = it;
           it = it->next;
@@ -794,22 +808,27 @@ collect_tags_mapper (struct taginfo *tag, void *arg)
 
 /* Analyze HTML tags FILE and construct a list of URLs referenced from
    it.  It merges relative links in FILE with URL.  It is aware of
-   <base href=...> and does the right thing.  */
+   <base href=...> and does the right thing.
+
+   If ARENA is not NULL, the list is allocated from it and released
+   along with it, rather than with free_urlpos.  */
 
 struct urlpos *
 get_urls_html_fm (const char *file, const struct file_memory *fm,
                     const char *url, bool *meta_disallow_follow,
-                    struct iri *iri)
+                    struct iri *iri, struct arena *arena)
 {
   struct map_context ctx;
   int flags;
 
   ctx.text = fm->content;
-  ctx.head = NULL;
+  ctx.text_offset = 0;
+  ctx.head = ctx.tail = NULL;
   ctx.base = NULL;
   ctx.parent_base = url ? url : opt.base_href;
   ctx.document_file = file;
   ctx.nofollow = false;
+  ctx.arena = arena;
 
   if (!interesting_tags)
     init_interesting ();
@@ -849,13 +868,264 @@ get_urls_html_fm (const char *file, const struct file_memory *fm,
   return ctx.head;
 }
 
+/* Parsing the documents as they arrive.
+
+   During recursive retrieval, an HTML or CSS document that is to be
+   parsed for links is parsed while fd_read_body writes it, instead of
+   being read back from the file once it is complete.  Of the text
+   that has arrived, only the part that may still hold links is kept:
+   a tag or a token that the end of the data cuts short, and the
+   contents of an open <style> element.  Should that ever be more than
+   LINKS_STREAM_MAX bytes, the document is read from the file as
+   before.
+
+   There is a single stream, for the document being downloaded.  Its
+   links are taken by get_urls_html or get_urls_css_file, provided
+   the file is still the one that was written.  */
+
+#define LINKS_STREAM_MAX (1024 * 1024)
+
+static struct {
+  char *file;                   /* the file the document is saved to */
+  char *url;                    /* its URL, which its links are
+                                   relative to */
+  bool css;                     /* whether it is CSS rather than HTML */
+  bool complete;                /* whether all of it has been parsed */
+
+  char *text;                   /* the part of the document at hand */
+  int length;                   /* the number of bytes in TEXT */
+  int allocated;                /* the size of TEXT */
+  int start;                    /* where the parsing goes on in TEXT */
+  int parse_at;                 /* the LENGTH at which to parse again */
+  wgint size;                   /* the size of the document */
+  dev_t dev;                    /* the identity of FILE */
+  ino_t ino;
+
+  struct html_parser parser;
+  struct map_context ctx;
+  struct arena arena;           /* where the links are allocated */
+  char *meta_charset;           /* the charset found in a <meta> tag */
+} stream;
+
+/* Whether documents are never parsed as they are downloaded.  */
+static bool stream_disabled;
+
+/* Forget the document being parsed, and whatever was found in it.  */
+
+void
+links_stream_drop (void)
+{
+  /* A charset found in a document given up on is no longer of use. */
+  if (stream.file && !stream.complete)
+    xfree (meta_charset);
+  html_parser_free (&stream.parser);
+  arena_free (&stream.arena);
+  xfree (stream.ctx.base);
+  xfree (stream.file);
+  xfree (stream.url);
+  xfree (stream.text);
+  xfree (stream.meta_charset);
+  xzero (stream);
+}
+
+/* Don't parse documents as they are downloaded from now on, because
+   their links are not looked for by this process.  */
+
+void
+links_stream_disable (void)
+{
+  links_stream_drop ();
+  stream_disabled = true;
+}
+
+/* Start parsing the document at URL, HTML or CSS, that is about to be
+   downloaded to FILE.  Return false if documents are not parsed as
+   they are downloaded.  */
+
+bool
+links_stream_start (const char *file, const char *url, bool css)
+{
+  links_stream_drop ();
+  if (stream_disabled)
+    return false;
+  if (!interesting_tags)
+    init_interesting ();
+
+  stream.file = xstrdup (file);
+  stream.url = xstrdup (url);
+  stream.css = css;
+
+  stream.ctx.parent_base = stream.url;
+  stream.ctx.document_file = stream.file;
+  stream.ctx.arena = &stream.arena;
+
+  /* As in get_urls_html_fm.  */
+  stream.parser.mapfun = collect_tags_mapper;
+  stream.parser.maparg = &stream.ctx;
+  stream.parser.flags = MHT_TRIM_VALUES;
+  if (opt.strict_comments)
+    stream.parser.flags |= MHT_STRICT_COMMENTS;
+  stream.parser.allowed_attributes = interesting_attributes;
+  stream.parser.content_tags = interesting_contents;
+  return true;
+}
+
+/* Parse the text at hand, all of it if COMPLETE, and drop what is no
+   longer needed.  */
+
+static void
+links_stream_parse (bool complete)
+{
+  int keep;
+
+  if (!stream.text)
+    return;
+  stream.ctx.text = stream.text;
+  if (stream.css)
+    {
+      stream.start += get_urls_css_part (&stream.ctx, stream.start,
+                                         stream.length - stream.start,
+                                         complete);
+      keep = stream.start;
+    }
+  else
+    keep = map_html_tags_part (&stream.parser, stream.text, stream.length,
+                               stream.ctx.text_offset, &stream.start,
+                               complete);
+
+  if (complete)
+    return;
+
+  if (stream.length - keep > LINKS_STREAM_MAX)
+    {
+      DEBUGP (("Too much of %s pending, it will be read from the file.\n",
+               stream.file));
+      links_stream_drop ();
+      return;
+    }
+
+  /* Move the text still needed to the front, unless there is more of
+     it than of what it replaces.  */
+  if (keep >= stream.length - keep)
+    {
+      memmove (stream.text, stream.text + keep, stream.length - keep);
+      stream.length -= keep;
+      stream.start -= keep;
+      stream.ctx.text_offset += keep;
+    }
+
+  /* A tag or a comment left unfinished is parsed again from its
+     beginning, so wait until twice as much text has arrived.  */
+  stream.parse_at = stream.length + MAX (stream.length - stream.start, 1);
+}
+
+/* Parse BUF, the next SIZE bytes of the document.  */
+
+void
+links_stream_feed (const char *buf, int size)
+{
+  if (!stream.file || stream.complete)
+    return;
+
+  if (stream.length + size > stream.allocated)
+    {
+      stream.allocated = MAX (2 * stream.allocated, stream.length + size);
+      stream.text = xrealloc (stream.text, stream.allocated);
+    }
+  memcpy (stream.text + stream.length, buf, size);
+  stream.length += size;
+  stream.size += size;
+
+  if (stream.length >= stream.parse_at)
+    links_stream_parse (false);
+}
+
+/* The whole document has been written to FP.  Parse what is left of
+   it.  */
+
+void
+links_stream_finish (FILE *fp)
+{
+  struct stat st;
+
+  if (!stream.file || stream.complete)
+    return;
+  if (fstat (fileno (fp), &st) != 0)
+    {
+      links_stream_drop ();
+      return;
+    }
+  stream.dev = st.st_dev;
+  stream.ino = st.st_ino;
+
+  links_stream_parse (true);
+  html_parser_free (&stream.parser);
+  xfree (stream.text);
+  stream.length = stream.allocated = stream.start = 0;
+  stream.complete = true;
+
+  stream.meta_charset = meta_charset;
+  meta_charset = NULL;
+}
+
+/* If the links of FILE, the HTML or CSS document at URL, have been
+   found as it was downloaded, store them to *URLS, allocated from
+   ARENA, which must be empty, and return true.  META_DISALLOW_FOLLOW
+   and IRI are as in get_urls_html.  */
+
+bool
+links_stream_take (const char *file, const char *url, bool css,
+                   struct arena *arena, struct urlpos **urls,
+                   bool *meta_disallow_follow, struct iri *iri)
+{
+  struct stat st;
+
+  if (!stream.complete || stream.css != css || !arena || arena->block
+      || strcmp (stream.file, file) != 0 || strcmp (stream.url, url) != 0)
+    return false;
+
+  /* Make sure the file is still the one that was written.  */
+  if (stat (file, &st) != 0 || st.st_dev != stream.dev
+      || st.st_ino != stream.ino || st.st_size != stream.size)
+    {
+      links_stream_drop ();
+      return false;
+    }
+
+  DEBUGP (("Parsed %s (size %s) as it was downloaded.\n", file,
+           number_to_static_string (stream.size)));
+
+  if (stream.ctx.nofollow)
+    logprintf (LOG_VERBOSE, _("no-follow attribute found in %s. Will not follow any links on this page\n"), file);
+  DEBUGP (("no-follow in %s: %d\n", file, stream.ctx.nofollow));
+  if (meta_disallow_follow)
+    *meta_disallow_follow = stream.ctx.nofollow;
+
+#ifdef ENABLE_IRI
+  if (iri && !iri->content_encoding && stream.meta_charset)
+    set_content_encoding (iri, stream.meta_charset);
+#endif
+
+  *urls = stream.ctx.head;
+  *arena = stream.arena;
+  xzero (stream.arena);
+  links_stream_drop ();
+  return true;
+}
+
 struct urlpos *
 get_urls_html (const char *file, const char *url, bool *meta_disallow_follow,
-                 struct iri *iri)
+                 struct iri *iri, struct arena *arena)
 {
   struct urlpos *urls;
   struct file_memory *fm;
 
+  /* If the file has just been downloaded, it has been parsed
+     already.  */
+  if (url && links_stream_take (file, url, false, arena, &urls,
+                                meta_disallow_follow, iri))
+    return urls;
+
   fm = wget_read_file (file);
   if (!fm)
     {
@@ -864,7 +1134,7 @@ get_urls_html (const char *file, const char *url, bool *meta_disallow_follow,
     }
   DEBUGP (("Loaded %s (size %s).\n", file, number_to_static_string (fm->length)));
 
-  urls = get_urls_html_fm (file, fm, url, meta_disallow_follow, iri);
+  urls = get_urls_html_fm (file, fm, url, meta_disallow_follow, iri, arena);
   wget_read_file_free (fm);
   return urls;
 }
@@ -973,5 +1243,8 @@ cleanup_html_url (void)
     hash_table_destroy (interesting_tags);
   if (interesting_attributes)
     hash_table_destroy (interesting_attributes);
+  if (interesting_contents)
+    hash_table_destroy (interesting_contents);
+  links_stream_drop ();
 }
 #endif
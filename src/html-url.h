@@ -38,6 +38,8 @@ as that of the covered work.  */
 
 struct map_context {
   char *text;                   /* HTML text. */
+  int text_offset;              /* Where TEXT is in the document, if
+                                   it is only a part of it. */
   char *base;                   /* Base URI of the document, possibly
                                    changed through <base href=...>. */
   const char *parent_base;      /* Base of the current document. */
@@ -46,13 +48,26 @@ struct map_context {
                                    <meta name=robots> tag. */
 
   struct urlpos *head;          /* List of URLs that is being built. */
+  struct urlpos *tail;          /* Its last element. */
+  struct arena *arena;          /* Where the list is allocated, or NULL
+                                   for malloc. */
 };
 
 struct urlpos *get_urls_file (const char *);
-struct urlpos *get_urls_html (const char *, const char *, bool *, struct iri *);
-struct urlpos *get_urls_html_fm (const char *, const struct file_memory *, const char *, bool *, struct iri *);
+struct urlpos *get_urls_html (const char *, const char *, bool *, struct iri *,
+                              struct arena *);
+struct urlpos *get_urls_html_fm (const char *, const struct file_memory *, const char *, bool *, struct iri *,
+                                 struct arena *);
 struct urlpos *append_url (const char *, int, int, struct map_context *);
 void free_urlpos (struct urlpos *);
 void cleanup_html_url (void);
 
+void links_stream_disable (void);
+bool links_stream_start (const char *, const char *, bool);
+void links_stream_feed (const char *, int);
+void links_stream_finish (FILE *);
+void links_stream_drop (void);
+bool links_stream_take (const char *, const char *, bool, struct arena *,
+                        struct urlpos **, bool *, struct iri *);
+
 #endif /* HTML_URL_H */
@@ -29,11 +29,14 @@
 #include "cookies.h"
 #include "md5.h"
 #include "convert.h"
+#include "html-url.h"
 #include "spider.h"
 #include "warc.h"
 #include "c-strcase.h"
 #include "version.h"
 #include "xstrndup.h"
+#include "ptimer.h"
+#include "progress.h"
 #ifdef HAVE_METALINK
 # include "metalink.h"
 #endif
@@ -294,15 +297,14 @@ request_remove_header (struct request *req, const char *name)
   p += A_len;                                   \
 } while (0)
 
-/* Construct the request and write it to FD using fd_write.
-   If warc_tmp is set to a file pointer, the request string will
-   also be written to that file. */
+/* Construct the request and return it as a string, whose length is
+   stored to *SIZE_REF.  */
 
-static int
-request_send (const struct request *req, int fd, FILE *warc_tmp)
+static char *
+request_format (const struct request *req, int *size_ref)
 {
   char *request_string, *p;
-  int i, size, write_error;
+  int i, size;
 
   /* Count the request size. */
   size = 0;
@@ -344,17 +346,32 @@ request_send (const struct request *req, int fd, FILE *warc_tmp)
 
   DEBUGP (("\n---request begin---\n%s---request end---\n", request_string));
 
+  *size_ref = size - 1;
+  return request_string;
+}
+
+/* Construct the request and write it to FD using fd_write.
+   If warc_tmp is set to a file pointer, the request string will
+   also be written to that file. */
+
+static int
+request_send (const struct request *req, int fd, FILE *warc_tmp)
+{
+  int size, write_error;
+  char *request_string = request_format (req, &size);
+
   /* Send the request to the server. */
 
-  write_error = fd_write (fd, request_string, size - 1, -1);
+  write_error = fd_write (fd, request_string, size, -1);
   if (write_error < 0)
     logprintf (LOG_VERBOSE, _("Failed writing HTTP request: %s.\n"),
                fd_errstr (fd));
   else if (warc_tmp != NULL)
     {
       /* Write a copy of the data to the WARC record. */
-      int warc_tmp_written = fwrite (request_string, 1, size - 1, warc_tmp);
-      if (warc_tmp_written != size - 1)
+      int warc_tmp_written = warc_tempfile_write (warc_tmp, request_string,
+                                                  size);
+      if (warc_tmp_written != size)
         write_error = -2;
     }
   xfree (request_string);
@@ -468,7 +485,7 @@ body_file_send (int sock, const char *file_name, wgint promised_size, FILE *warc
       if (warc_tmp != NULL)
         {
           /* Write a copy of the data to the WARC record. */
-          int warc_tmp_written = fwrite (chunk, 1, towrite, warc_tmp);
+          int warc_tmp_written = warc_tempfile_write (warc_tmp, chunk, towrite);
           if (warc_tmp_written != towrite)
             {
               fclose (fp);
@@ -886,6 +903,21 @@ parse_content_range (const char *hdr, wgint *first_byte_ptr,
 {
   wgint num;
 
+  /* Ancient versions of Netscape proxy server, presumably predating
+     rfc2068, sent out `Content-Range' without the "bytes"
+     specifier.  */
+  if (0 == c_strncasecmp (hdr, "bytes", 5))
+    {
+      hdr += 5;
+      /* "JavaWebServer/1.1.1" sends "bytes: x-y/z", contrary to the
+         HTTP spec. */
+      if (*hdr == ':')
+        ++hdr;
+      while (c_isspace (*hdr))
+        ++hdr;
+      if (!*hdr)
+        return false;
+    }
   if (!c_isdigit (*hdr))
     return false;
   for (num = 0; c_isdigit (*hdr); hdr++)
@@ -1309,20 +1341,22 @@ parse_strict_transport_security (const char *header, time_t *max_age, bool *incl
 }
 #endif
 
-/* Persistent connections.  Currently, we cache the most recently used
-   connection as persistent, provided that the HTTP server agrees to
-   make it such.  The persistence data is stored in the variables
-   below.  Ideally, it should be possible to cache an arbitrary fixed
-   number of these connections.  */
-
-/* Whether a persistent connection is active. */
-static bool pconn_active;
-
-static struct {
+/* Persistent connections.  The connection most recently used is kept
+   in PCONN as long as the HTTP server agrees to keep it alive.  When a
+   connection to another host is registered, the previous one is not
+   closed, but moved to a small pool of idle connections, so that a
+   crawl alternating between a few hosts doesn't have to reconnect on
+   every request.  The pool holds at most opt.max_idle_connections
+   connections; when it is full, the one that has been idle the longest
+   is closed.  Connections idle for longer than opt.keep_alive_timeout
+   seconds are closed as well, since the server has most likely given
+   up on them by then.  */
+
+struct persistent_connection {
   /* The socket of the connection.  */
   int socket;
 
-  /* Host and port of the currently active persistent connection. */
+  /* Host and port of the connection. */
   char *host;
   int port;
 
@@ -1335,11 +1369,41 @@ static struct {
      useful optimization.)  */
   bool authorized;
 
+  /* When the connection was put in the idle pool. */
+  time_t idle_since;
+
+  /* URLs of the requests sent ahead on this connection whose responses
+     haven't been read yet, in the order they were sent.  */
+  char **pipeline;
+  int pipeline_count;
+
 #ifdef ENABLE_NTLM
-  /* NTLM data of the current connection.  */
+  /* NTLM data of the connection.  */
   struct ntlmdata ntlm;
 #endif
-} pconn;
+};
+
+/* Whether a persistent connection is active. */
+static bool pconn_active;
+
+/* The active persistent connection. */
+static struct persistent_connection pconn;
+
+/* Idle persistent connections, least recently used first. */
+static struct persistent_connection *pconn_pool;
+static int pconn_pool_count;
+
+/* Forget the requests pipelined on PC.  */
+
+static void
+pconn_free_pipeline (struct persistent_connection *pc)
+{
+  int i;
+  for (i = 0; i < pc->pipeline_count; i++)
+    xfree (pc->pipeline[i]);
+  xfree (pc->pipeline);
+  pc->pipeline_count = 0;
+}
 
 /* Mark the persistent connection as invalid and free the resources it
    uses.  This is used by the CLOSE_* macros after they forcefully
@@ -1352,16 +1416,100 @@ invalidate_persistent (void)
   pconn_active = false;
   fd_close (pconn.socket);
   xfree (pconn.host);
+  pconn_free_pipeline (&pconn);
   xzero (pconn);
 }
 
+/* Close the idle connection at position I of the pool and remove it
+   from the pool.  */
+
+static void
+pool_drop (int i)
+{
+  struct persistent_connection *pc = &pconn_pool[i];
+
+  DEBUGP (("Closing idle connection %d to %s:%d.\n",
+           pc->socket, pc->host, pc->port));
+  fd_close (pc->socket);
+  xfree (pc->host);
+  pconn_free_pipeline (pc);
+  memmove (pc, pc + 1, (--pconn_pool_count - i) * sizeof (*pc));
+}
+
+/* Close the idle connections the server has probably closed on its
+   end by now.  */
+
+static void
+pool_expire (void)
+{
+  time_t now;
+  int i;
+
+  if (!pconn_pool_count)
+    return;
+
+  now = time (NULL);
+  for (i = 0; i < pconn_pool_count; )
+    if (opt.keep_alive_timeout > 0
+        && now - pconn_pool[i].idle_since > opt.keep_alive_timeout)
+      pool_drop (i);
+    else
+      ++i;
+}
+
+/* Move the active persistent connection to the pool of idle
+   connections, or close it if the pool is disabled.  */
+
+static void
+pool_park_active (void)
+{
+  if (!pconn_active)
+    return;
+
+  if (opt.max_idle_connections <= 0)
+    {
+      invalidate_persistent ();
+      return;
+    }
+
+  pool_expire ();
+  if (pconn_pool_count >= opt.max_idle_connections)
+    pool_drop (0);
+  if (!pconn_pool)
+    pconn_pool = xnew_array (struct persistent_connection,
+                             opt.max_idle_connections);
+
+  DEBUGP (("Keeping socket %d to %s:%d for later reuse.\n",
+           pconn.socket, pconn.host, pconn.port));
+  pconn.idle_since = time (NULL);
+  pconn_pool[pconn_pool_count++] = pconn;
+  pconn_active = false;
+  xzero (pconn);
+}
+
+/* Make the idle connection at position I of the pool the active
+   persistent connection, in place of the current one.  */
+
+static void
+pool_activate (int i)
+{
+  struct persistent_connection pc = pconn_pool[i];
+
+  memmove (&pconn_pool[i], &pconn_pool[i + 1],
+           (--pconn_pool_count - i) * sizeof (pc));
+  pool_park_active ();
+  pconn = pc;
+  pconn_active = true;
+}
+
 /* Register FD, which should be a TCP/IP connection to HOST:PORT, as
    persistent.  This will enable someone to use the same connection
    later.  In the context of HTTP, this must be called only AFTER the
    response has been received and the server has promised that the
    connection will remain alive.
 
-   If a previous connection was persistent, it is closed. */
+   If a previous connection was persistent, it is moved to the pool
+   of idle connections. */
 
 static void
 register_persistent (const char *host, int port, int fd, bool ssl)
@@ -1375,12 +1523,12 @@ register_persistent (const char *host, int port, int fd, bool ssl)
         }
       else
         {
-          /* The old persistent connection is still active; close it
-             first.  This situation arises whenever a persistent
+          /* The old persistent connection is still active; put it
+             aside.  This situation arises whenever a persistent
              connection exists, but we then connect to a different
              host, and try to register a persistent connection to that
              one.  */
-          invalidate_persistent ();
+          pool_park_active ();
         }
     }
 
@@ -1388,69 +1536,147 @@ register_persistent (const char *host, int port, int fd, bool ssl)
   pconn.socket = fd;
   pconn.host = xstrdup (host);
   pconn.port = port;
+  pconn.ssl = ssl;
   pconn.authorized = false;
 
   DEBUGP (("Registered socket %d for persistent reuse.\n", fd));
 }
 
-/* Return true if a persistent connection is available for connecting
-   to HOST:PORT.  */
+/* Return true if PC is a connection to HOST:PORT, with SSL if SSL is
+   true, and without otherwise.  AL, if non-NULL, holds the addresses
+   of HOST; a connection to any of them is considered as good as a
+   connection to HOST.  */
 
 static bool
-persistent_available_p (const char *host, int port,
-                        bool *host_lookup_failed)
+pconn_matches (const struct persistent_connection *pc, const char *host,
+               int port, bool ssl, struct address_list *al)
 {
-  /* First, check whether a persistent connection is active at all.  */
-  if (!pconn_active)
-    return false;
+  ip_address ip;
 
-  /* If we're not connecting to the same port, we're not interested. */
-  if (port != pconn.port)
+  /* A connection still owing us responses can't take new requests. */
+  if (port != pc->port || ssl != pc->ssl || pc->pipeline_count)
     return false;
+  if (0 == strcasecmp (host, pc->host))
+    return true;
 
-  /* If the host is the same, we're in business.  If not, there is
-     still hope -- read below.  */
-  if (0 != strcasecmp (host, pconn.host))
-    {
+  /* If the socket's peer is one of the IP addresses HOST resolves to,
+     the socket is for all intents and purposes already talking to
+     HOST.  */
+  return al
+    && socket_ip_address (pc->socket, &ip, ENDPOINT_PEER)
+    && address_list_contains (al, &ip);
+}
 
-      bool found;
-      ip_address ip;
-      struct address_list *al;
+/* Return true if a persistent connection is available for connecting
+   to HOST:PORT, with SSL if SSL is true.  The connection is then the
+   active one, i.e. in PCONN.  */
 
-      /* If pconn.socket's peer is one of the IP addresses HOST
-         resolves to, pconn.socket is for all intents and purposes
-         already talking to HOST.  */
+static bool
+persistent_available_p (const char *host, int port, bool ssl,
+                        bool *host_lookup_failed)
+{
+  struct address_list *al = NULL;
+  bool need_lookup = false;
+  int i;
 
-      if (!socket_ip_address (pconn.socket, &ip, ENDPOINT_PEER))
-        {
+  pool_expire ();
 
+  /* First, check whether a persistent connection is active at all.  */
+  if (!pconn_active && !pconn_pool_count)
+    return false;
+
+  /* Look for a connection to the same host name first, the most
+     recently used first.  Only if there is none do we bother to look
+     up the host, in order to find a connection to one of its
+     addresses.  */
+  for (;;)
+    {
+      if (pconn_active && pconn_matches (&pconn, host, port, ssl, al))
+        {
+          if (test_socket_open (pconn.socket))
+            break;
           invalidate_persistent ();
+        }
+      for (i = pconn_pool_count - 1; i >= 0; i--)
+        if (pconn_matches (&pconn_pool[i], host, port, ssl, al))
+          {
+            if (test_socket_open (pconn_pool[i].socket))
+              break;
+            pool_drop (i);
+          }
+      if (i >= 0)
+        {
+          pool_activate (i);
+          break;
+        }
+
+      if (al || need_lookup)
+        {
+          if (al)
+            address_list_release (al);
           return false;
         }
+
+      /* Is there a connection to the same port at all? */
+      if (pconn_active && port == pconn.port)
+        need_lookup = true;
+      for (i = 0; i < pconn_pool_count; i++)
+        if (port == pconn_pool[i].port)
+          need_lookup = true;
+      if (!need_lookup)
+        return false;
+
       al = lookup_host (host, 0);
       if (!al)
         {
           *host_lookup_failed = true;
           return false;
         }
+    }
 
-      found = address_list_contains (al, &ip);
-      address_list_release (al);
+  if (al)
+    address_list_release (al);
+  return true;
+}
 
-      if (!found)
-        return false;
-    }
+#if defined DEBUG_MALLOC || defined TESTING
+/* Close all the persistent connections. */
+
+static void
+persistent_cleanup (void)
+{
+  if (pconn_active)
+    invalidate_persistent ();
+  while (pconn_pool_count)
+    pool_drop (pconn_pool_count - 1);
+  xfree (pconn_pool);
+}
+#endif
+
+/* Forget the persistent connections without shutting them down.  This
+   is for a forked process, which must neither use the connections it
+   shares with its parent, nor close them on the parent's behalf.  */
 
-  if (!test_socket_open (pconn.socket))
+void
+http_forget_connections (void)
+{
+  if (pconn_active)
     {
-      invalidate_persistent ();
-      return false;
+      fd_abandon (pconn.socket);
+      xfree (pconn.host);
+      pconn_free_pipeline (&pconn);
+      xzero (pconn);
+      pconn_active = false;
+    }
+  while (pconn_pool_count)
+    {
+      --pconn_pool_count;
+      fd_abandon (pconn_pool[pconn_pool_count].socket);
+      xfree (pconn_pool[pconn_pool_count].host);
+      pconn_free_pipeline (&pconn_pool[pconn_pool_count]);
     }
-
-  return true;
 }
 
-
 /* The idea behind these two CLOSE macros is to distinguish between
    two cases: one when the job we've been doing is finished, and we
    want to close the connection and leave, and two when something is
@@ -1530,6 +1756,9 @@ struct http_stat
   encoding_t remote_encoding;   /* the encoding of the remote file */
 
   bool temporary;               /* downloading a temporary file */
+  int scan_links;               /* TEXTHTML or TEXTCSS if the body is
+                                   to be parsed for links as it
+                                   arrives */
 };
 
 static void
@@ -1605,10 +1834,12 @@ read_response_body (struct http_stat *hs, int sock, FILE *fp, wgint contlen,
         {
           /* We should keep the response headers for the WARC record.  */
           int head_len = strlen (head);
-          int warc_tmp_written = fwrite (head, 1, head_len, warc_tmp);
+          int warc_tmp_written = warc_tempfile_write (warc_tmp, head,
+                                                      head_len);
           if (warc_tmp_written != head_len)
             warcerr = WARC_TMP_FWRITEERR;
           warc_payload_offset = head_len;
+          warc_tempfile_payload_start (warc_tmp);
         }
 
       if (warcerr != 0)
@@ -1637,6 +1868,13 @@ read_response_body (struct http_stat *hs, int sock, FILE *fp, wgint contlen,
     /* If the server ignored our range request, instruct fd_read_body
        to skip the first RESTVAL bytes of body.  */
     flags |= rb_skip_startpos;
+  if (fp != NULL && fp != output_stream && hs->scan_links
+      && hs->restval == 0 && !opt.save_headers
+      && links_stream_start (hs->local_file, url,
+                             hs->scan_links == TEXTCSS))
+    flags |= rb_scan_links;
+  else
+    links_stream_drop ();
   if (chunked_transfer_encoding)
     flags |= rb_chunked_transfer_encoding;
 
@@ -1651,6 +1889,13 @@ read_response_body (struct http_stat *hs, int sock, FILE *fp, wgint contlen,
   hs->res = fd_read_body (hs->local_file, sock, fp, contlen != -1 ? contlen : 0,
                           hs->restval, &hs->rd_size, &hs->len, &hs->dltime,
                           flags, warc_tmp);
+  if (flags & rb_scan_links)
+    {
+      if (hs->res >= 0)
+        links_stream_finish (fp);
+      else
+        links_stream_drop ();
+    }
   if (hs->res >= 0)
     {
       if (warc_tmp != NULL)
@@ -1873,6 +2118,193 @@ initialize_request (const struct url *u, struct http_stat *hs, int *dt,
   return req;
 }
 
+/* Add the headers that are recomputed each time REQ is sent: the
+   cookies and the user headers.  */
+
+static void
+request_set_late_headers (struct request *req, const struct url *u)
+{
+  if (opt.cookies)
+    request_set_header (req, "Cookie",
+                        cookie_header (wget_cookie_jar,
+                                       u->host, u->port, u->path,
+                                      0
+                                       ),
+                        rel_value);
+
+  /* Add the user headers. */
+  if (opt.user_headers)
+    {
+      int i;
+      for (i = 0; opt.user_headers[i]; i++)
+        request_set_user_header (req, opt.user_headers[i]);
+    }
+}
+
+/* HTTP pipelining.  When opt.http_pipeline is positive, requests for
+   the URLs that are going to be retrieved next from the same host are
+   sent on a reused persistent connection ahead of time, and their
+   responses are read when gethttp gets to them.  The caller announces
+   the upcoming URLs with http_pipeline_hint.
+
+   Only plain GET requests whose contents don't depend on the outcome
+   of the previous ones are pipelined.  If the server closes the
+   connection or answers with garbage, pipelining is turned off and the
+   request is sent again on its own.  */
+
+/* The URLs announced by the caller, with their referers. */
+static const char **pipeline_urls;
+static const char **pipeline_referers;
+static int pipeline_url_count;
+
+/* Set when the server has shown that it can't cope with pipelining. */
+static bool pipeline_failed;
+
+/* Announce that the COUNT URLs in URLS will be retrieved next, in that
+   order.  REFERERS holds the referer of each.  The arrays must remain
+   valid until the next call.  */
+
+void
+http_pipeline_hint (const char **urls, const char **referers, int count)
+{
+  pipeline_urls = urls;
+  pipeline_referers = referers;
+  pipeline_url_count = count;
+}
+
+/* Return true if requests may currently be pipelined. */
+
+static bool
+pipeline_enabled (void)
+{
+  return opt.http_pipeline > 0 && !pipeline_failed
+    && opt.http_keep_alive && !opt.ignore_length
+    && !opt.method && !opt.spider && !opt.warc_filename
+    && !opt.timestamping && !opt.noclobber && !opt.always_rest
+    && !opt.wait && !opt.user && !opt.http_user;
+}
+
+/* Return true if credentials apply to U.  A request for U may then be
+   answered with 401 and have to be sent again with an authorization,
+   after the requests pipelined behind it.  */
+
+static bool
+pipeline_has_credentials (const struct url *u)
+{
+  const char *user = u->user;
+  const char *passwd = u->passwd;
+
+  if (user)
+    return true;
+  search_netrc (u->host, &user, &passwd, 0, NULL);
+  return user != NULL;
+}
+
+/* If the request for U has been pipelined, make its connection the
+   active persistent connection and return true.  A connection to the
+   same host whose next pipelined request is for another URL is out of
+   sync with the retrieval and gets closed.  */
+
+static bool
+pipeline_take (const struct url *u)
+{
+  struct persistent_connection *pc;
+  int i;
+
+  for (i = -1; i < pconn_pool_count; )
+    {
+      pc = i < 0 ? &pconn : &pconn_pool[i];
+      if ((i >= 0 || pconn_active) && pc->pipeline_count
+          && pc->port == u->port && 0 == strcasecmp (pc->host, u->host))
+        {
+          if (0 == strcmp (pc->pipeline[0], u->url))
+            {
+              if (i >= 0)
+                pool_activate (i);
+              xfree (pconn.pipeline[0]);
+              memmove (pconn.pipeline, pconn.pipeline + 1,
+                       --pconn.pipeline_count * sizeof (char *));
+              return true;
+            }
+          DEBUGP (("Pipelined request for %s not wanted, closing socket %d.\n",
+                   pc->pipeline[0], pc->socket));
+          if (i < 0)
+            invalidate_persistent ();
+          else
+            {
+              pool_drop (i);
+              continue;
+            }
+        }
+      ++i;
+    }
+  return false;
+}
+
+/* Send requests for the announced URLs on the active persistent
+   connection, which is about to answer the request for U, until
+   opt.http_pipeline requests are in flight after it.  */
+
+static void
+pipeline_fill (const struct url *u)
+{
+  int i;
+
+  if (!pconn.pipeline)
+    pconn.pipeline = xnew_array (char *, opt.http_pipeline);
+
+  for (i = 0; i < pipeline_url_count
+         && pconn.pipeline_count < opt.http_pipeline; i++)
+    {
+      struct url *next = url_parse (pipeline_urls[i], NULL, NULL, false);
+      struct http_stat hs;
+      struct request *req;
+      char *user, *passwd;
+      bool basic_auth_finished;
+      wgint body_data_size;
+      uerr_t err;
+      int dt = 0;
+
+      /* Stop at the first URL that won't be retrieved over this
+         connection, since the responses must be read in order.  */
+      if (!next || next->scheme != u->scheme || next->port != u->port
+          || 0 != strcasecmp (next->host, u->host)
+          || pipeline_has_credentials (next))
+        {
+          if (next)
+            url_free (next);
+          break;
+        }
+
+      /* The first announced URLs may have been pipelined already. */
+      if (i < pconn.pipeline_count)
+        {
+          bool same = 0 == strcmp (pconn.pipeline[i], next->url);
+          url_free (next);
+          if (!same)
+            break;
+          continue;
+        }
+
+      xzero (hs);
+      hs.referer = pipeline_referers[i];
+      req = initialize_request (next, &hs, &dt, false, &basic_auth_finished,
+                                &body_data_size, &user, &passwd, &err);
+      request_set_late_headers (req, next);
+      if (request_send (req, pconn.socket, NULL) < 0)
+        {
+          request_free (&req);
+          url_free (next);
+          break;
+        }
+      DEBUGP (("Pipelined request for %s on socket %d.\n",
+               next->url, pconn.socket));
+      pconn.pipeline[pconn.pipeline_count++] = xstrdup (next->url);
+      request_free (&req);
+      url_free (next);
+    }
+}
+
 
 static uerr_t
 establish_connection (const struct url *u, const struct url **conn_ref,
@@ -1887,6 +2319,36 @@ establish_connection (const struct url *u, const struct url **conn_ref,
   int write_error;
   int statcode;
 
+  /* Look for a persistent connection to the target host.  */
+  if (sock < 0 && !inhibit_keep_alive)
+    {
+      bool host_lookup_failed = false;
+
+      /* Requests are only sent in the clear here, so a connection
+         that carries SSL won't do.  */
+      if (persistent_available_p (conn->host, conn->port, false,
+                                  &host_lookup_failed))
+        {
+          sock = pconn.socket;
+          logprintf (LOG_VERBOSE, _("Reusing existing connection to %s:%d.\n"),
+                     quotearg_style (escape_quoting_style, pconn.host),
+                     pconn.port);
+          DEBUGP (("Reusing fd %d.\n", sock));
+          if (pconn.authorized)
+            /* If the connection is already authorized, the "Basic"
+               authorization added by code above is unnecessary and
+               only hurts us.  */
+            request_remove_header (req, "Authorization");
+        }
+      else if (host_lookup_failed)
+        {
+          logprintf (LOG_NOTQUIET,
+                     _("%s: unable to resolve host address %s\n"),
+                     exec_name, quote (conn->host));
+          return HOSTERR;
+        }
+    }
+
   /* Since we're not using a proxy, we'll establish a direct connection to the host. */
   if (sock < 0)
     {
@@ -2312,6 +2774,673 @@ set_content_type (int *dt, const char *type)
     *dt &= ~TEXTCSS;
 }
 
+/* Segmented downloads.
+
+   With --segments=N, a large file is downloaded over several
+   connections at once.  When the response to the ordinary request
+   shows that the server knows the length of the file and accepts byte
+   ranges, the file is allocated at its full size and split in up to N
+   segments.  The body of that response supplies the first segment,
+   and the others are requested with Range headers over connections of
+   their own, each writing at its own offset in the file.  All the
+   connections are driven from this process by an fd_loop: each one
+   goes from connecting in the background, to reading the response
+   head, to streaming the body, as the loop reports it ready.
+
+   Until the download is complete, the segments that remain to be
+   downloaded are listed in a state file next to the file, named after
+   it with SEGMENTS_SUFFIX appended.  The state file is what lets -c,
+   and the retries after an error, continue every segment where it
+   stopped rather than append to a file that already has its full
+   size.  It also records the validator of the file, its strong ETag
+   or else its Last-Modified date: the segments are requested with
+   If-Range, and a download is only continued if the file still has
+   the same validator, so that the parts of two versions of the file
+   are never put together.  */
+
+#define SEGMENTS_SUFFIX ".wget-segments"
+
+/* Files are not split in segments smaller than this.  */
+#define SEGMENT_MIN_SIZE (1024 * 1024)
+
+/* The most connections a file is downloaded over.  */
+#define SEGMENTS_MAX 64
+
+struct segment {
+  wgint start;                  /* first byte still to download */
+  wgint end;                    /* one past the last byte */
+};
+
+/* Return the name of the state file of FILE.  */
+
+static char *
+segments_state_file (const char *file)
+{
+  return aprintf ("%s%s", file, SEGMENTS_SUFFIX);
+}
+
+/* Return true if an earlier segmented download of FILE is
+   unfinished.  */
+
+static bool
+segments_pending_p (const char *file)
+{
+  char *state = segments_state_file (file);
+  bool pending = file_exists_p (state, NULL);
+  xfree (state);
+  return pending;
+}
+
+/* Remove the state file of FILE, if any.  */
+
+static void
+segments_forget (const char *file)
+{
+  char *state = segments_state_file (file);
+  if (unlink (state) < 0 && errno != ENOENT)
+    logprintf (LOG_NOTQUIET, "%s: %s\n", state, strerror (errno));
+  xfree (state);
+}
+
+/* Record in the state file of FILE that the unfinished segments among
+   the COUNT in SEGS remain to be downloaded from URL, whose length is
+   LENGTH and whose validator is VALIDATOR, if not NULL.
+
+   The first line of the file holds the URL, the second one the
+   length, the third one the validator, empty if there is none, and
+   each of the following ones the start and end offsets of a
+   segment.  */
+
+static void
+segments_save (const char *file, const char *url, wgint length,
+               const char *validator, const struct segment *segs, int count)
+{
+  char *state = segments_state_file (file);
+  FILE *fp = fopen (state, "w");
+  bool ok = false;
+  int i;
+
+  if (fp)
+    {
+      fprintf (fp, "%s\n%s\n%s\n", url, number_to_static_string (length),
+               validator ? validator : "");
+      for (i = 0; i < count; i++)
+        if (segs[i].start < segs[i].end)
+          fprintf (fp, "%s %s\n", number_to_static_string (segs[i].start),
+                   number_to_static_string (segs[i].end));
+      ok = !ferror (fp);
+      if (fclose (fp) != 0)
+        ok = false;
+    }
+  if (!ok)
+    logprintf (LOG_NOTQUIET, _("Cannot save the download state to %s: %s\n"),
+               quote (state), strerror (errno));
+  xfree (state);
+}
+
+/* Read into SEGS the segments that remain to be downloaded of FILE,
+   according to its state file.  Returns their number, or 0 if there
+   is no state file, or if it is not about URL, its length LENGTH and
+   its validator VALIDATOR.  */
+
+static int
+segments_load (const char *file, const char *url, wgint length,
+               const char *validator, struct segment *segs)
+{
+  char *state = segments_state_file (file);
+  FILE *fp = fopen (state, "r");
+  char *line = NULL;
+  size_t len = 0;
+  ssize_t n;
+  int count = 0;
+
+  xfree (state);
+  if (!fp)
+    return 0;
+
+  /* The URL and the length.  */
+  n = getline (&line, &len, fp);
+  if (n <= 0 || line[n - 1] != '\n'
+      || strlen (url) != (size_t) n - 1 || strncmp (line, url, n - 1) != 0
+      || getline (&line, &len, fp) <= 0
+      || str_to_wgint (line, NULL, 10) != length)
+    goto bad;
+
+  /* The validator.  */
+  n = getline (&line, &len, fp);
+  if (n <= 0 || line[n - 1] != '\n')
+    goto bad;
+  line[n - 1] = '\0';
+  if (0 != strcmp (line, validator ? validator : ""))
+    {
+      logprintf (LOG_VERBOSE, _("%s has changed on the server.\n"), url);
+      goto bad;
+    }
+
+  while (getline (&line, &len, fp) > 0)
+    {
+      struct segment seg;
+      char *p;
+
+      seg.start = str_to_wgint (line, &p, 10);
+      seg.end = str_to_wgint (p, &p, 10);
+      if (*p != '\n' || seg.start < 0 || seg.start >= seg.end
+          || seg.end > length || count == SEGMENTS_MAX)
+        goto bad;
+      segs[count++] = seg;
+    }
+  if (!count)
+    goto bad;
+
+  fclose (fp);
+  xfree (line);
+  return count;
+
+ bad:
+  DEBUGP (("Ignoring the download state of %s.\n", quote (file)));
+  fclose (fp);
+  xfree (line);
+  return 0;
+}
+
+/* A segmented download in progress.  */
+
+struct segment_run {
+  struct fd_loop *loop;
+  const struct url *u;
+  struct request *req;          /* the request the segments are asked
+                                   for with */
+  const char *validator;        /* the validator sent in If-Range */
+  struct address_list *al;      /* the addresses of the host */
+  const char *file;
+  FILE *fp;                     /* the stream open on FILE */
+  struct ptimer *timer;
+  void *progress;
+  char *buf;                    /* where the body is read to */
+  int open;                     /* the connections still in use */
+  bool write_error;             /* whether writing to FILE failed */
+  bool changed;                 /* whether the file changed on the
+                                   server */
+};
+
+/* The connection a segment is downloaded over.  */
+
+struct segment_conn {
+  struct segment_run *run;
+  struct segment *seg;
+  int sock;
+  enum {
+    SEG_CONNECTING,             /* waiting for the connection */
+    SEG_HEAD,                   /* reading the response head */
+    SEG_BODY                    /* reading the body */
+  } state;
+  int addr;                     /* the address connected to */
+  char *head;                   /* the response head read so far */
+  int head_len;
+  double active;                /* when the connection last made
+                                   progress */
+  bool borrowed;                /* whether the socket is gethttp's */
+};
+
+/* The size of the reads of the body.  */
+#define SEGMENT_READ_SIZE 16384
+
+static void segment_ready (int, int, void *);
+
+/* Stop using the connection of C.  The socket gethttp lent is left
+   for it to close.  */
+
+static void
+segment_close (struct segment_conn *c)
+{
+  if (c->sock < 0)
+    return;
+  fd_loop_remove (c->run->loop, c->sock);
+  if (!c->borrowed)
+    fd_close (c->sock);
+  c->sock = -1;
+  xfree (c->head);
+  c->head_len = 0;
+  --c->run->open;
+}
+
+/* Give up on the segment of C, for the reason in WHY.  */
+
+static void
+segment_fail (struct segment_conn *c, const char *why)
+{
+  logprintf (LOG_VERBOSE, _("Failed to download bytes %s-%s: %s.\n"),
+             number_to_static_string (c->seg->start),
+             number_to_static_string (c->seg->end - 1), why);
+  segment_close (c);
+}
+
+/* Start connecting C to the next address of the host, from the
+   address at position FROM on.  Returns false if there is none left
+   to try.  */
+
+static bool
+segment_connect (struct segment_conn *c, int from)
+{
+  struct segment_run *run = c->run;
+  int start, end, i;
+
+  address_list_get_bounds (run->al, &start, &end);
+  for (i = MAX (from, start); i < end; i++)
+    {
+      int sock = connect_to_ip_start (address_list_address_at (run->al, i),
+                                      run->u->port);
+      if (sock < 0)
+        continue;
+      if (!fd_loop_add (run->loop, sock, WAIT_FOR_WRITE, segment_ready, c))
+        {
+          fd_close (sock);
+          return false;
+        }
+      c->sock = sock;
+      c->addr = i;
+      c->state = SEG_CONNECTING;
+      c->active = ptimer_read (run->timer);
+      ++run->open;
+      return true;
+    }
+  return false;
+}
+
+/* Write the LEN bytes of the body in DATA at the position of the
+   segment of C.  */
+
+static void
+segment_write (struct segment_conn *c, const char *data, wgint len)
+{
+  struct segment_run *run = c->run;
+
+  len = MIN (len, c->seg->end - c->seg->start);
+  if (fseeko (run->fp, c->seg->start, SEEK_SET) < 0
+      || fwrite (data, 1, len, run->fp) != (size_t) len)
+    {
+      run->write_error = true;
+      return;
+    }
+  c->seg->start += len;
+  c->active = ptimer_read (run->timer);
+  if (run->progress)
+    progress_update (run->progress, len, c->active);
+  if (opt.limit_rate)
+    limit_bandwidth (len, run->timer);
+  if (c->seg->start == c->seg->end)
+    segment_close (c);
+}
+
+/* The connection of C is established: send the request for its
+   segment.  */
+
+static void
+segment_request (struct segment_conn *c)
+{
+  struct segment_run *run = c->run;
+  char *request;
+  int size;
+
+  if (connect_finish (c->sock) < 0)
+    {
+      int from = c->addr + 1;
+
+      DEBUGP (("Connecting socket %d failed: %s\n", c->sock,
+               strerror (errno)));
+      segment_close (c);
+      if (!segment_connect (c, from))
+        segment_fail (c, _("cannot connect"));
+      return;
+    }
+
+  request_set_header (run->req, "Range",
+                      aprintf ("bytes=%s-%s",
+                               number_to_static_string (c->seg->start),
+                               number_to_static_string (c->seg->end - 1)),
+                      rel_value);
+  /* The request is much smaller than the send buffer of a new
+     connection, so writing it doesn't block.  */
+  request = request_format (run->req, &size);
+  if (fd_write (c->sock, request, size, 0) < 0)
+    segment_fail (c, fd_errstr (c->sock));
+  else
+    {
+      c->state = SEG_HEAD;
+      c->active = ptimer_read (run->timer);
+      fd_loop_modify (run->loop, c->sock, WAIT_FOR_READ);
+    }
+  xfree (request);
+}
+
+/* Read more of the response head of C.  Once it is complete, check
+   that it answers with the segment, and go on with the body that came
+   along with it.  A 200 response to If-Range means that the file has
+   changed on the server.  */
+
+static void
+segment_read_head (struct segment_conn *c)
+{
+  struct response *resp;
+  const char *end;
+  char *head, hdrval[256];
+  wgint first, last, entity;
+  int n;
+
+  if (!c->head)
+    c->head = xmalloc (HTTP_RESPONSE_MAX_SIZE);
+  n = fd_read (c->sock, c->head + c->head_len,
+               HTTP_RESPONSE_MAX_SIZE - c->head_len, 0);
+  if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    return;
+  if (n <= 0)
+    {
+      segment_fail (c, n < 0 ? fd_errstr (c->sock)
+                    : _("Connection closed"));
+      return;
+    }
+  c->active = ptimer_read (c->run->timer);
+
+  end = response_head_terminator (c->head, c->head + c->head_len, n);
+  c->head_len += n;
+  if (!end)
+    {
+      if (c->head_len == HTTP_RESPONSE_MAX_SIZE)
+        segment_fail (c, _("Malformed status line"));
+      return;
+    }
+
+  head = xstrndup (c->head, end - c->head);
+  resp = resp_new (head);
+  if (end != c->head && c->run->validator
+      && resp_status (resp, NULL) == HTTP_STATUS_OK)
+    {
+      logprintf (LOG_NOTQUIET, _("%s has changed on the server.\n"),
+                 c->run->u->url);
+      c->run->changed = true;
+      segment_close (c);
+    }
+  else if (end == c->head
+      || resp_status (resp, NULL) != HTTP_STATUS_PARTIAL_CONTENTS
+      || !resp_header_copy (resp, "Content-Range", hdrval, sizeof (hdrval))
+      || !parse_content_range (hdrval, &first, &last, &entity)
+      || first != c->seg->start || last != c->seg->end - 1
+      || (resp_header_copy (resp, "Transfer-Encoding", hdrval,
+                            sizeof (hdrval))
+          && 0 == c_strcasecmp (hdrval, "chunked")))
+    {
+      logprintf (LOG_NOTQUIET,
+                 _("The server did not send bytes %s-%s of %s.\n"),
+                 number_to_static_string (c->seg->start),
+                 number_to_static_string (c->seg->end - 1), c->run->u->url);
+      segment_close (c);
+    }
+  else
+    {
+      c->state = SEG_BODY;
+      if (c->head + c->head_len > end)
+        segment_write (c, end, c->head + c->head_len - end);
+    }
+  resp_free (&resp);
+  xfree (head);
+}
+
+/* Called by the fd_loop when the connection of the segment_conn ARG
+   is ready.  */
+
+static void
+segment_ready (int fd, int ready, void *arg)
+{
+  struct segment_conn *c = arg;
+  struct segment_run *run = c->run;
+  int n;
+
+  (void) fd;
+  (void) ready;
+
+  switch (c->state)
+    {
+    case SEG_CONNECTING:
+      segment_request (c);
+      break;
+    case SEG_HEAD:
+      segment_read_head (c);
+      break;
+    case SEG_BODY:
+      n = fd_read (c->sock, run->buf,
+                   MIN (SEGMENT_READ_SIZE, c->seg->end - c->seg->start), 0);
+      if (n > 0)
+        segment_write (c, run->buf, n);
+      else if (n == 0)
+        segment_fail (c, _("Connection closed"));
+      else if (errno != EAGAIN && errno != EWOULDBLOCK)
+        segment_fail (c, fd_errstr (c->sock));
+      break;
+    }
+}
+
+/* Return the validator of the file RESP describes, to be sent in
+   If-Range: its ETag unless the ETag is weak, which If-Range doesn't
+   accept, or else its Last-Modified date.  Returns NULL if the
+   response has neither.  */
+
+static char *
+segments_validator (const struct response *resp)
+{
+  const char *b, *e;
+
+  if (resp_header_get (resp, "ETag", &b, &e)
+      && !(e - b >= 2 && b[0] == 'W' && b[1] == '/'))
+    return strdupdelim (b, e);
+  return resp_header_strdup (resp, "Last-Modified");
+}
+
+/* Decide whether to download the file HS describes in segments.  The
+   response RESP to REQ is known to be a 200 with a body of CONTLEN
+   bytes.  The segments are stored in SEGS, and *RESUME is set if they
+   are those left unfinished by an earlier download.  *VALIDATOR is
+   set to the validator of the file, or NULL.  Returns the number of
+   segments, or 0 to download the file the usual way.  */
+
+static int
+segments_plan (const struct http_stat *hs, const struct url *u,
+               const struct response *resp, const struct request *req,
+               wgint contlen, bool chunked_transfer_encoding, int count,
+               struct segment *segs, char **validator, bool *resume)
+{
+  char hdrval[64];
+  int n, i;
+
+  *resume = false;
+  *validator = NULL;
+  if (opt.segments <= 1 && !opt.always_rest && count <= 1)
+    return 0;
+
+  if (output_stream || !req || hs->restval || contlen <= 0
+      || chunked_transfer_encoding || hs->remote_encoding != ENC_NONE
+      || opt.warc_filename || opt.save_headers || opt.method
+      || !resp_header_copy (resp, "Accept-Ranges", hdrval, sizeof (hdrval))
+      || 0 != c_strcasecmp (hdrval, "bytes"))
+    {
+      /* The server won't let us continue an earlier segmented
+         download; it is about to be started over.  */
+      if (!output_stream && !hs->restval && segments_pending_p (hs->local_file))
+        segments_forget (hs->local_file);
+      return 0;
+    }
+
+  *validator = segments_validator (resp);
+  if (opt.always_rest || count > 1)
+    {
+      n = segments_load (hs->local_file, u->url, contlen, *validator, segs);
+      if (n)
+        {
+          *resume = true;
+          return n;
+        }
+    }
+  segments_forget (hs->local_file);
+
+  n = MIN (opt.segments, SEGMENTS_MAX);
+  if (contlen / SEGMENT_MIN_SIZE < n)
+    n = contlen / SEGMENT_MIN_SIZE;
+  if (n <= 1)
+    {
+      xfree (*validator);
+      return 0;
+    }
+  for (i = 0; i < n; i++)
+    {
+      segs[i].start = contlen / n * i;
+      segs[i].end = i == n - 1 ? contlen : contlen / n * (i + 1);
+    }
+  return n;
+}
+
+/* Download the COUNT segments in SEGS of U, which is CONTLEN bytes
+   long, to HS->local_file, which FP is open on.  REQ is the request
+   the segments are asked for with, and VALIDATOR, if not NULL, the
+   validator of the file.  If SOCK is not -1, it is at the start of
+   the body of a response whose beginning is the first segment.  */
+
+static uerr_t
+segments_retrieve (struct http_stat *hs, int sock, FILE *fp,
+                   const struct url *u, struct request *req,
+                   const char *validator, wgint contlen,
+                   struct segment *segs, int count)
+{
+  struct segment_run run;
+  struct segment_conn conns[SEGMENTS_MAX];
+  wgint missing = 0, remaining = 0;
+  int i;
+
+  for (i = 0; i < count; i++)
+    missing += segs[i].end - segs[i].start;
+  segments_save (hs->local_file, u->url, contlen, validator, segs, count);
+  logprintf (LOG_VERBOSE, _("Downloading in %d segments.\n"), count);
+  if (validator)
+    request_set_header (req, "If-Range", validator, rel_none);
+
+  xzero (run);
+  run.loop = fd_loop_new ();
+  run.u = u;
+  run.req = req;
+  run.validator = validator;
+  run.file = hs->local_file;
+  run.fp = fp;
+  run.timer = ptimer_new ();
+  run.buf = xmalloc (SEGMENT_READ_SIZE);
+  if (opt.show_progress)
+    run.progress = progress_create (hs->local_file, contlen - missing,
+                                    contlen);
+  if (opt.limit_rate)
+    limit_bandwidth_reset ();
+
+  for (i = 0; i < count; i++)
+    {
+      struct segment_conn *c = &conns[i];
+
+      xzero (*c);
+      c->run = &run;
+      c->seg = &segs[i];
+      c->sock = -1;
+      /* The body of this response is the first segment.  */
+      if (i == 0 && sock >= 0 && fd_set_nonblocking (sock, true)
+          && fd_loop_add (run.loop, sock, WAIT_FOR_READ, segment_ready, c))
+        {
+          c->sock = sock;
+          c->state = SEG_BODY;
+          c->borrowed = true;
+          ++run.open;
+          continue;
+        }
+      if (!run.al)
+        run.al = lookup_host (u->host, 0);
+      if (run.al && !segment_connect (c, 0))
+        segment_fail (c, _("cannot connect"));
+    }
+
+  while (run.open && !run.write_error && !run.changed)
+    {
+      double now;
+
+      if (fd_loop_run (run.loop, 1) < 0)
+        {
+          logprintf (LOG_NOTQUIET, "epoll: %s\n", strerror (errno));
+          break;
+        }
+
+      /* Give up on the connections that have been silent for too
+         long.  */
+      now = ptimer_read (run.timer);
+      for (i = 0; i < count; i++)
+        {
+          struct segment_conn *c = &conns[i];
+          double timeout = opt.read_timeout;
+
+          if (c->sock < 0)
+            continue;
+          if (c->state == SEG_CONNECTING && opt.connect_timeout)
+            timeout = opt.connect_timeout;
+          if (timeout && now - c->active > timeout)
+            segment_fail (c, _("Read error (Connection timed out)"));
+        }
+      if (run.progress)
+        progress_update (run.progress, 0, now);
+    }
+
+  for (i = 0; i < count; i++)
+    segment_close (&conns[i]);
+
+  if (fflush (fp) != 0)
+    run.write_error = true;
+  if (run.write_error)
+    logprintf (LOG_NOTQUIET, "%s: %s\n", hs->local_file, strerror (errno));
+
+  hs->dltime = ptimer_measure (run.timer);
+  if (run.progress)
+    progress_finish (run.progress, hs->dltime);
+  ptimer_destroy (run.timer);
+  if (run.al)
+    address_list_release (run.al);
+  fd_loop_delete (run.loop);
+  xfree (run.buf);
+
+  for (i = 0; i < count; i++)
+    remaining += segs[i].end - segs[i].start;
+  hs->rd_size = missing - remaining;
+  hs->len = contlen - remaining;
+
+  if (run.changed)
+    {
+      /* Start over with the new version of the file.  */
+      segments_forget (hs->local_file);
+      if (ftruncate (fileno (fp), 0) < 0)
+        logprintf (LOG_NOTQUIET, "%s: %s\n", hs->local_file,
+                   strerror (errno));
+      hs->rd_size = 0;
+      hs->len = 0;
+      hs->res = -1;
+      xfree (hs->rderrmsg);
+      hs->rderrmsg = xstrdup (_("the file changed on the server"));
+    }
+  else if (!remaining)
+    {
+      segments_forget (hs->local_file);
+      hs->res = 0;
+    }
+  else
+    {
+      segments_save (hs->local_file, u->url, contlen, validator, segs,
+                     count);
+      hs->res = -1;
+      xfree (hs->rderrmsg);
+      hs->rderrmsg = xstrdup (run.write_error
+                              ? _("cannot write to the file")
+                              : _("some segments are incomplete"));
+    }
+  return run.write_error ? FWRITEERR : RETRFINISHED;
+}
 
 
 /* Retrieve a document through HTTP protocol.  It recognizes status
@@ -2401,6 +3530,15 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
   bool inhibit_keep_alive =
     !opt.http_keep_alive || opt.ignore_length;
 
+  /* Whether the request has already been sent by pipeline_fill.  */
+  bool pipelined = false;
+
+  /* The segments the body is downloaded in, if it is.  */
+  struct segment segs[SEGMENTS_MAX];
+  int nsegs = 0;
+  bool resume_segments = false;
+  char *segs_validator = NULL;
+
   /* Headers sent when using POST. */
   wgint body_data_size = 0;
 
@@ -2420,6 +3558,9 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
   if (inhibit_keep_alive)
     keep_alive = false;
 
+  if (opt.http_pipeline > 0 && !hs->restval && !head_only && !cond_get)
+    pipelined = pipeline_take (u);
+
 {
     uerr_t conn_err = establish_connection (u, &conn, hs, &req, inhibit_keep_alive, NULL);
     if (conn_err != RETROK)
@@ -2434,31 +3575,26 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
      without authorization header fails.  (Expected to happen at least
      for the Digest authorization scheme.)  */
 
-  if (opt.cookies)
-    request_set_header (req, "Cookie",
-                        cookie_header (wget_cookie_jar,
-                                       u->host, u->port, u->path,
-                                      0
-                                       ),
-                        rel_value);
+  request_set_late_headers (req, u);
 
-  /* Add the user headers. */
-  if (opt.user_headers)
+  keep_alive = true;
+
+  /* If the request has been sent ahead, just read the response. */
+  if (pipelined)
     {
-      int i;
-      for (i = 0; opt.user_headers[i]; i++)
-        request_set_user_header (req, opt.user_headers[i]);
+      sock = pconn.socket;
+      logprintf (LOG_VERBOSE, _("Reusing existing connection to %s:%d.\n"),
+                 quotearg_style (escape_quoting_style, pconn.host),
+                 pconn.port);
     }
 
-  keep_alive = true;
-
   /* Establish the connection.  */
   if (inhibit_keep_alive)
     keep_alive = false;
 
   {
     uerr_t conn_err = establish_connection (u, &conn, hs, &req,
-                                            inhibit_keep_alive, NULL);
+                                            inhibit_keep_alive, &sock);
     if (conn_err != RETROK)
       {
         retval = conn_err;
@@ -2481,7 +3617,10 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
 
 
   /* Send the request to server.  */
-  write_error = request_send (req, sock, warc_tmp);
+  if (pipelined)
+    write_error = 0;
+  else
+    write_error = request_send (req, sock, warc_tmp);
 
   if (write_error >= 0)
     {
@@ -2495,9 +3634,11 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
 
               /* Remember end of headers / start of payload. */
               warc_payload_offset = ftello (warc_tmp);
+              warc_tempfile_payload_start (warc_tmp);
 
               /* Write a copy of the data to the WARC record. */
-              warc_tmp_written = fwrite (opt.body_data, 1, body_data_size, warc_tmp);
+              warc_tmp_written = warc_tempfile_write (warc_tmp, opt.body_data,
+                                                      body_data_size);
               if (warc_tmp_written != body_data_size)
                 write_error = -2;
             }
@@ -2505,8 +3646,11 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
       else if (opt.body_file && body_data_size != 0)
         {
           if (warc_tmp != NULL)
-            /* Remember end of headers / start of payload */
-            warc_payload_offset = ftello (warc_tmp);
+            {
+              /* Remember end of headers / start of payload */
+              warc_payload_offset = ftello (warc_tmp);
+              warc_tempfile_payload_start (warc_tmp);
+            }
 
           write_error = body_file_send (sock, opt.body_file, body_data_size, warc_tmp);
         }
@@ -2529,6 +3673,10 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
   contrange = 0;
   *dt &= ~RETROKF;
 
+  if (pipeline_enabled () && pconn_active && sock == pconn.socket
+      && !pipeline_has_credentials (u))
+    pipeline_fill (u);
+
 
   if (warc_enabled)
     {
@@ -2559,6 +3707,8 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
     do
       {
         head = read_http_response_head (sock);
+        if (!head && pipelined)
+          goto pipeline_broken;
         if (!head)
           {
             if (errno == 0)
@@ -2583,6 +3733,12 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
         /* Check for status line.  */
         xfree (message);
         statcode = resp_status (resp, &message);
+        if (statcode < 0 && pipelined)
+          {
+            xfree (head);
+            resp_free (&resp);
+            goto pipeline_broken;
+          }
         if (statcode < 0)
           {
             char *tms = datetime_str (time (NULL));
@@ -2610,6 +3766,9 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
     while (_repeat);
   }
 
+  /* Should we have to send the request again, it won't be pipelined. */
+  pipelined = false;
+
   xfree (hs->message);
   hs->message = xstrdup (message);
   if (!opt.server_response)
@@ -2656,6 +3815,12 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
         }
     }
 
+  if (keep_alive)
+    /* The server has promised that it will not close the connection
+       when we're done.  This means that we can register it.  */
+    register_persistent (conn->host, conn->port, sock,
+                         fd_transport_registered (sock));
+
   chunked_transfer_encoding = false;
   if (resp_header_copy (resp, "Transfer-Encoding", hdrval, sizeof (hdrval))
       && 0 == c_strcasecmp (hdrval, "chunked"))
@@ -2730,6 +3895,14 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
             CLOSE_INVALIDATE (sock);
         }
 
+      /* The request sent again with an authorization would be answered
+         after the ones pipelined behind this one.  */
+      if (pconn_active && sock == pconn.socket && pconn.pipeline_count)
+        {
+          CLOSE_INVALIDATE (sock);
+          pipeline_failed = true;
+        }
+
       pconn.authorized = false;
 
       {
@@ -3268,7 +4441,27 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
       goto cleanup;
     }
 
-  err = open_output_stream (hs, count, &fp);
+  if (statcode == HTTP_STATUS_OK && contrange == 0)
+    nsegs = segments_plan (hs, u, resp, req, contlen,
+                           chunked_transfer_encoding, count, segs,
+                           &segs_validator, &resume_segments);
+
+  if (resume_segments)
+    {
+      /* The file already has its full size; its missing segments are
+         to be written in place.  */
+      fp = fopen (hs->local_file, "r+b");
+      if (!fp)
+        {
+          logprintf (LOG_NOTQUIET, "%s: %s\n", hs->local_file,
+                     strerror (errno));
+          err = FOPENERR;
+        }
+      else
+        err = RETROK;
+    }
+  else
+    err = open_output_stream (hs, count, &fp);
   if (err != RETROK)
     {
       CLOSE_INVALIDATE (sock);
@@ -3276,6 +4469,14 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
       goto cleanup;
     }
 
+  /* Allocate the whole file at once, so that each segment can be
+     written at its offset.  */
+  if (nsegs && !resume_segments && ftruncate (fileno (fp), contlen) < 0)
+    {
+      logprintf (LOG_NOTQUIET, "%s: %s\n", hs->local_file, strerror (errno));
+      nsegs = 0;
+    }
+
 #ifdef ENABLE_XATTR
   if (opt.enable_xattr)
     {
@@ -3286,21 +4487,50 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
     }
 #endif
 
-  err = read_response_body (hs, sock, fp, contlen, contrange,
-                            chunked_transfer_encoding,
-                            u->url, warc_timestamp_str,
-                            warc_request_uuid, warc_ip, type,
-                            statcode, head);
-
-  if (hs->res >= 0)
-    CLOSE_FINISH (sock);
+  if (nsegs)
+    {
+      /* The rest of the body of this response is either downloaded
+         by other means or not needed at all.  */
+      if (resume_segments)
+        CLOSE_INVALIDATE (sock);
+      err = segments_retrieve (hs, sock, fp, u, req, segs_validator,
+                               contlen, segs, nsegs);
+      if (sock >= 0)
+        CLOSE_INVALIDATE (sock);
+    }
   else
-    CLOSE_INVALIDATE (sock);
+    {
+      hs->scan_links = 0;
+      if (opt.recursive || opt.page_requisites)
+        hs->scan_links = (*dt & TEXTCSS) ? TEXTCSS : (*dt & TEXTHTML);
+      err = read_response_body (hs, sock, fp, contlen, contrange,
+                                chunked_transfer_encoding,
+                                u->url, warc_timestamp_str,
+                                warc_request_uuid, warc_ip, type,
+                                statcode, head);
+
+      if (hs->res >= 0)
+        CLOSE_FINISH (sock);
+      else
+        CLOSE_INVALIDATE (sock);
+    }
 
   if (!output_stream)
     fclose (fp);
 
   retval = err;
+  goto cleanup;
+
+ pipeline_broken:
+  /* The server closed the connection instead of answering the
+     pipelined request, or got out of sync.  Send the request again on
+     its own, and stop pipelining.  */
+  logputs (LOG_VERBOSE,
+           _("Pipelined request failed, retrying without pipelining.\n"));
+  pipeline_failed = true;
+  pipelined = false;
+  CLOSE_INVALIDATE (sock);
+  goto retry_with_auth;
 
   cleanup:
   xfree (head);
@@ -3308,6 +4538,7 @@ gethttp (const struct url *u, struct url *original_url, struct http_stat *hs,
   xfree (message);
   resp_free (&resp);
   request_free (&req);
+  xfree (segs_validator);
 
   return retval;
 }
@@ -3483,6 +4714,11 @@ http_loop (const struct url *u, struct url *original_url, char **newloc,
       /* Decide whether or not to restart.  */
       if (force_full_retrieve)
         hstat.restval = hstat.len;
+      else if (got_name && (opt.always_rest || count > 1)
+               && segments_pending_p (hstat.local_file))
+        /* The file was being downloaded in segments; the missing ones
+           are downloaded again, into the full-size file.  */
+        hstat.restval = 0;
       else if (opt.start_pos >= 0)
         hstat.restval = opt.start_pos;
       else if (opt.always_rest
@@ -4438,8 +5674,7 @@ save_cookies (void)
 void
 http_cleanup (void)
 {
-  if (pconn_active)
-    invalidate_persistent ();
+  persistent_cleanup ();
 
   if (wget_cookie_jar)
     {
@@ -39,6 +39,8 @@ uerr_t http_loop (const struct url *, struct url *, char **, char **, const char
                   int *, struct iri *);
 void save_cookies (void);
 void http_cleanup (void);
+void http_forget_connections (void);
+void http_pipeline_hint (const char **, const char **, int);
 time_t http_atotm (const char *);
 
 typedef struct {
@@ -144,6 +144,7 @@ static const struct {
 #ifdef HAVE_LIBCARES
   { "binddnsaddress",   &opt.bind_dns_address,  cmd_string },
 #endif
+  { "bloomfilter",      &opt.bloom_filter,      cmd_boolean },
   { "bodydata",         &opt.body_data,         cmd_string },
   { "bodyfile",         &opt.body_file,         cmd_string },
   { "cache",            &opt.allow_cache,       cmd_boolean },
@@ -155,9 +156,12 @@ static const struct {
   { "contentdisposition", &opt.content_disposition, cmd_boolean },
   { "contentonerror",   &opt.content_on_error,  cmd_boolean },
   { "continue",         &opt.always_rest,       cmd_boolean },
+  { "convertearly",     &opt.convert_early,     cmd_boolean },
   { "convertfileonly",  &opt.convert_file_only, cmd_boolean },
   { "convertlinks",     &opt.convert_links,     cmd_boolean },
   { "cookies",          &opt.cookies,           cmd_boolean },
+  { "crawlstate",       &opt.crawl_state,       cmd_file },
+  { "crawlstateinterval", &opt.crawl_state_interval, cmd_time },
   { "cutdirs",          &opt.cut_dirs,          cmd_number },
   { "debug",            &opt.debug,             cmd_boolean },
   { "defaultpage",      &opt.default_page,      cmd_string },
@@ -165,6 +169,9 @@ static const struct {
   { "dirprefix",        &opt.dir_prefix,        cmd_directory },
   { "dirstruct",        NULL,                   cmd_spec_dirstruct },
   { "dnscache",         &opt.dns_cache,         cmd_boolean },
+  { "dnscachefile",     &opt.dns_cache_file,    cmd_file },
+  { "dnscachesize",     &opt.dns_cache_size,    cmd_number },
+  { "dnscachettl",      &opt.dns_cache_ttl,     cmd_time },
 #ifdef HAVE_LIBCARES
   { "dnsservers",       &opt.dns_servers,       cmd_string },
 #endif
@@ -177,6 +184,7 @@ static const struct {
 
   { "excludedirectories", &opt.excludes,        cmd_directory_vector },
   { "excludedomains",   &opt.exclude_domains,   cmd_vector },
+  { "flushinterval",    &opt.flush_interval,    cmd_time },
   { "followftp",        &opt.follow_ftp,        cmd_boolean },
   { "followtags",       &opt.follow_tags,       cmd_vector },
   { "forcehtml",        &opt.force_html,        cmd_boolean },
@@ -194,6 +202,7 @@ static const struct {
   { "httpkeepalive",    &opt.http_keep_alive,   cmd_boolean },
   { "httppasswd",       &opt.http_passwd,       cmd_string }, /* deprecated */
   { "httppassword",     &opt.http_passwd,       cmd_string },
+  { "httppipeline",     &opt.http_pipeline,     cmd_number },
 
   { "httpuser",         &opt.http_user,         cmd_string },
   { "ifmodifiedsince",  &opt.if_modified_since, cmd_boolean },
@@ -210,6 +219,7 @@ static const struct {
   { "inputmetalink",    &opt.input_metalink,    cmd_file },
 #endif
   { "iri",              &opt.enable_iri,        cmd_boolean },
+  { "keepalivetimeout", &opt.keep_alive_timeout, cmd_time },
   { "keepbadhash",      &opt.keep_badhash,      cmd_boolean },
   { "keepsessioncookies", &opt.keep_session_cookies, cmd_boolean },
   { "limitrate",        &opt.limit_rate,        cmd_bytes },
@@ -217,6 +227,7 @@ static const struct {
   { "localencoding",    &opt.locale,            cmd_string },
   { "logfile",          &opt.lfilename,         cmd_file },
   { "login",            &opt.ftp_user,          cmd_string },/* deprecated*/
+  { "maxidleconnections", &opt.max_idle_connections, cmd_number },
   { "maxredirect",      &opt.max_redirect,      cmd_number },
 #ifdef HAVE_METALINK
   { "metalinkindex",    &opt.metalink_index,     cmd_number_inf },
@@ -231,6 +242,7 @@ static const struct {
   { "numtries",         &opt.ntry,              cmd_number_inf },/* deprecated*/
   { "outputdocument",   &opt.output_document,   cmd_file },
   { "pagerequisites",   &opt.page_requisites,   cmd_boolean },
+  { "parallel",         &opt.parallel,          cmd_number },
   { "passiveftp",       &opt.ftp_pasv,          cmd_boolean },
   { "passwd",           &opt.ftp_passwd,        cmd_string },/* deprecated*/
   { "password",         &opt.passwd,            cmd_string },
@@ -245,10 +257,12 @@ static const struct {
 
   { "progress",         &opt.progress_type,     cmd_spec_progress },
   { "protocoldirectories", &opt.protocol_directories, cmd_boolean },
+  { "queuememory",      &opt.queue_memory,      cmd_number },
   { "quiet",            &opt.quiet,             cmd_boolean },
   { "quota",            &opt.quota,             cmd_bytes_sum },
 
   { "randomwait",       &opt.random_wait,       cmd_boolean },
+  { "readbuffer",       &opt.read_buffer,       cmd_bytes },
   { "readtimeout",      &opt.read_timeout,      cmd_time },
   { "reclevel",         &opt.reclevel,          cmd_number_inf },
   { "recursive",        NULL,                   cmd_spec_recursive },
@@ -269,6 +283,7 @@ static const struct {
   { "robots",           &opt.use_robots,        cmd_boolean },
   { "savecookies",      &opt.cookies_output,    cmd_file },
   { "saveheaders",      &opt.save_headers,      cmd_boolean },
+  { "segments",         &opt.segments,          cmd_number },
 
   { "serverresponse",   &opt.server_response,   cmd_boolean },
   { "showalldnsentries", &opt.show_all_dns_entries, cmd_boolean },
@@ -295,6 +310,7 @@ static const struct {
   { "warccdxdedup",     &opt.warc_cdx_dedup_filename,  cmd_file },
 #ifdef HAVE_LIBZ
   { "warccompression",  &opt.warc_compression_enabled, cmd_boolean },
+  { "warccompressionthreads", &opt.warc_compression_threads, cmd_number },
 #endif
   { "warcdigests",      &opt.warc_digests_enabled, cmd_boolean },
   { "warcfile",         &opt.warc_filename,     cmd_file },
@@ -305,6 +321,7 @@ static const struct {
 #ifdef USE_WATT32
   { "wdebug",           &opt.wdebug,            cmd_boolean },
 #endif
+  { "writebuffer",      &opt.write_buffer,      cmd_bytes },
 #ifdef ENABLE_XATTR
   { "xattr",            &opt.enable_xattr,      cmd_boolean },
 #endif
@@ -355,11 +372,14 @@ defaults (void)
   opt.verbose = -1;
   opt.ntry = 20;
   opt.reclevel = 5;
+  opt.queue_memory = 100000;
   opt.add_hostdir = true;
   opt.netrc = true;
   opt.ftp_glob = true;
   opt.htmlify = true;
   opt.http_keep_alive = true;
+  opt.max_idle_connections = 8;
+  opt.keep_alive_timeout = 30;
   opt.prefer_family = prefer_none;
   opt.allow_cache = true;
   opt.if_modified_since = true;
@@ -374,6 +394,8 @@ defaults (void)
   opt.dots_in_line = 50;
 
   opt.dns_cache = true;
+  opt.dns_cache_size = 4096;
+  opt.dns_cache_ttl = 300;
   opt.ftp_pasv = true;
   /* 2014-09-07  Darshit Shah  <darnir@gmail.com>
    * opt.retr_symlinks is set to true by default. Creating symbolic links on the
@@ -414,6 +436,11 @@ defaults (void)
 
   opt.waitretry = 10;
 
+  opt.read_buffer = 1024 * 1024;
+  opt.write_buffer = 1024 * 1024;
+  opt.flush_interval = 1;
+  opt.crawl_state_interval = 60;
+
 #ifdef ENABLE_IRI
   opt.enable_iri = true;
 #else
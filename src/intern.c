@@ -0,0 +1,304 @@
+/* Interned URL store.
+   Copyright (C) 2021 Free Software Foundation, Inc.
+
+This file is part of GNU Wget.
+
+GNU Wget is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 3 of the License, or
+ (at your option) any later version.
+
+GNU Wget is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Wget.  If not, see <http://www.gnu.org/licenses/>.
+
+Additional permission under GNU GPL version 3 section 7
+
+If you modify this program, or any covered work, by linking or
+combining it with the OpenSSL project's OpenSSL library (or a
+modified version of that library), containing parts covered by the
+terms of the OpenSSL or SSLeay licenses, the Free Software Foundation
+grants you additional permission to convey the resulting work.
+Corresponding Source for a non-source form of such a combination
+shall include the source code for the parts of OpenSSL used as well
+as that of the covered work.  */
+
+/* Recursive retrieval has to remember every URL it has seen: in the
+   queue, in the blacklist and in the download registry of convert.c.
+   With millions of URLs, keeping each of them as a separate malloc'd
+   string several times over adds up quickly, especially since URLs
+   from one site share long prefixes.
+
+   This file stores each string once and hands out a 32-bit id for it.
+   A string is split into segments after each slash (except a
+   trailing one), so "http://host/a/b.html" becomes "http:/", "/",
+   "host/", "a/" and "b.html".  Each distinct (parent, segment) pair
+   is stored once as a node whose id is the id of the string that ends
+   there.  URLs in the same directory therefore only cost one node for
+   their last segment.
+
+   Ids are never freed; the store lives as long as the process.  */
+
+#include "wget.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "intern.h"
+
+struct intern_node {
+  intern_id parent;             /* the string this one extends, or 0 */
+  intern_id next;               /* next node in the same bucket */
+  uint32_t hash;                /* hash of parent and segment */
+  uint32_t segment;             /* where the segment is stored */
+};
+
+/* Segments are stored NUL-terminated in large chunks.  The location
+   of a segment is the chunk number in the upper bits and the offset
+   in the lower CHUNK_BITS bits.  A segment that doesn't fit in a
+   chunk gets a chunk of its own.  */
+
+#define CHUNK_BITS 20
+#define CHUNK_SIZE (1 << CHUNK_BITS)
+#define MAX_CHUNKS (1 << (32 - CHUNK_BITS))
+
+static char **chunks;
+static int chunk_count, chunk_alloc;
+static int chunk_cap, chunk_used; /* size and use of the last chunk */
+
+/* Node 0 is unused so that 0 can mean "no string".  */
+static struct intern_node *nodes;
+static intern_id node_count, node_size;
+
+/* Hash buckets, each the head of a chain of nodes linked through
+   NEXT.  The number of buckets is a power of two.  */
+static intern_id *buckets;
+static uint32_t bucket_mask;
+
+#define SEGMENT(n) (chunks[(n)->segment >> CHUNK_BITS]                  \
+                    + ((n)->segment & (CHUNK_SIZE - 1)))
+
+static uint32_t
+hash_segment (intern_id parent, const char *beg, int len)
+{
+  /* FNV-1a, seeded with the parent.  */
+  uint32_t h = 2166136261u ^ (parent * 0x9e3779b1u);
+  int i;
+  for (i = 0; i < len; i++)
+    {
+      h ^= (unsigned char) beg[i];
+      h *= 16777619u;
+    }
+  return h;
+}
+
+static intern_id
+find_node (intern_id parent, const char *beg, int len, uint32_t hash)
+{
+  intern_id id;
+
+  if (!buckets)
+    return 0;
+  for (id = buckets[hash & bucket_mask]; id; id = nodes[id].next)
+    {
+      const struct intern_node *n = &nodes[id];
+      if (n->hash == hash && n->parent == parent)
+        {
+          const char *seg = SEGMENT (n);
+          if (memcmp (seg, beg, len) == 0 && seg[len] == '\0')
+            return id;
+        }
+    }
+  return 0;
+}
+
+/* Copy the segment [BEG, BEG+LEN) to the chunks and return its
+   location.  */
+
+static uint32_t
+store_segment (const char *beg, int len)
+{
+  uint32_t offset;
+
+  if (len + 1 > chunk_cap - chunk_used)
+    {
+      if (chunk_count == MAX_CHUNKS)
+        xalloc_die ();
+      if (chunk_count == chunk_alloc)
+        {
+          chunk_alloc = chunk_alloc ? chunk_alloc * 2 : 16;
+          chunks = xrealloc (chunks, chunk_alloc * sizeof *chunks);
+        }
+      chunk_cap = MAX (CHUNK_SIZE, len + 1);
+      chunks[chunk_count++] = xmalloc (chunk_cap);
+      chunk_used = 0;
+    }
+
+  offset = chunk_used;
+  memcpy (chunks[chunk_count - 1] + offset, beg, len);
+  chunks[chunk_count - 1][offset + len] = '\0';
+  chunk_used += len + 1;
+  /* Offsets past CHUNK_SIZE can't be represented, so an oversized
+     chunk holds only this segment.  */
+  if (chunk_cap > CHUNK_SIZE)
+    chunk_used = chunk_cap;
+  return ((uint32_t) (chunk_count - 1) << CHUNK_BITS) | offset;
+}
+
+static void
+grow_buckets (void)
+{
+  uint32_t count = buckets ? (bucket_mask + 1) * 2 : 1024;
+  intern_id id;
+
+  xfree (buckets);
+  buckets = xcalloc (count, sizeof *buckets);
+  bucket_mask = count - 1;
+  for (id = 1; id < node_count; id++)
+    {
+      struct intern_node *n = &nodes[id];
+      n->next = buckets[n->hash & bucket_mask];
+      buckets[n->hash & bucket_mask] = id;
+    }
+}
+
+static intern_id
+add_node (intern_id parent, const char *beg, int len, uint32_t hash)
+{
+  struct intern_node *n;
+  intern_id id;
+
+  if (node_count == node_size)
+    {
+      if (node_size >= UINT32_MAX / 2)
+        xalloc_die ();
+      node_size = node_size ? node_size * 2 : 1024;
+      nodes = xrealloc (nodes, node_size * sizeof *nodes);
+      if (node_count == 0)
+        node_count = 1;
+    }
+
+  id = node_count++;
+  n = &nodes[id];
+  n->parent = parent;
+  n->hash = hash;
+  n->segment = store_segment (beg, len);
+
+  if (!buckets || node_count > bucket_mask + 1)
+    grow_buckets ();            /* links the new node, too */
+  else
+    {
+      n->next = buckets[hash & bucket_mask];
+      buckets[hash & bucket_mask] = id;
+    }
+  return id;
+}
+
+/* Walk the segments of S, adding the missing ones if ADD is true.
+   Returns 0 if S is not in the store and ADD is false.  */
+
+static intern_id
+intern_1 (const char *s, bool add)
+{
+  const char *beg = s;
+  intern_id id = 0;
+
+  for (;;)
+    {
+      const char *end = strchr (beg, '/');
+      intern_id child;
+      uint32_t hash;
+      int len;
+
+      if (end && end[1])
+        ++end;
+      else
+        end = beg + strlen (beg);
+      len = end - beg;
+
+      hash = hash_segment (id, beg, len);
+      child = find_node (id, beg, len, hash);
+      if (!child)
+        {
+          if (!add)
+            return 0;
+          child = add_node (id, beg, len, hash);
+        }
+      id = child;
+      if (!*end)
+        return id;
+      beg = end;
+    }
+}
+
+/* Return the id of S, adding it to the store if needed.  Equal
+   strings always get the same id.  */
+
+intern_id
+intern (const char *s)
+{
+  return intern_1 (s, true);
+}
+
+/* Return the id of S if it was interned before, or 0.  */
+
+intern_id
+intern_lookup (const char *s)
+{
+  return intern_1 (s, false);
+}
+
+/* Return a freshly allocated copy of the string with id ID.  */
+
+char *
+intern_strdup (intern_id id)
+{
+  size_t len = 0;
+  intern_id i;
+  char *res, *p;
+
+  for (i = id; i; i = nodes[i].parent)
+    len += strlen (SEGMENT (&nodes[i]));
+
+  res = xmalloc (len + 1);
+  p = res + len;
+  *p = '\0';
+  for (i = id; i; i = nodes[i].parent)
+    {
+      const char *seg = SEGMENT (&nodes[i]);
+      size_t seglen = strlen (seg);
+      p -= seglen;
+      memcpy (p, seg, seglen);
+    }
+  return res;
+}
+
+/* Return the largest id handed out so far, or 0 if none.  Useful for
+   sizing tables indexed by id.  */
+
+intern_id
+intern_max_id (void)
+{
+  return node_count ? node_count - 1 : 0;
+}
+
+void
+intern_cleanup (void)
+{
+  int i;
+
+  for (i = 0; i < chunk_count; i++)
+    xfree (chunks[i]);
+  xfree (chunks);
+  xfree (nodes);
+  xfree (buckets);
+  chunk_count = chunk_alloc = chunk_cap = chunk_used = 0;
+  node_count = node_size = 0;
+  bucket_mask = 0;
+}
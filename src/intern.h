@@ -0,0 +1,49 @@
+/* Declarations for intern.c.
+   Copyright (C) 2021 Free Software Foundation, Inc.
+
+This file is part of GNU Wget.
+
+GNU Wget is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 3 of the License, or
+(at your option) any later version.
+
+GNU Wget is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Wget.  If not, see <http://www.gnu.org/licenses/>.
+
+Additional permission under GNU GPL version 3 section 7
+
+If you modify this program, or any covered work, by linking or
+combining it with the OpenSSL project's OpenSSL library (or a
+modified version of that library), containing parts covered by the
+terms of the OpenSSL or SSLeay licenses, the Free Software Foundation
+grants you additional permission to convey the resulting work.
+Corresponding Source for a non-source form of such a combination
+shall include the source code for the parts of OpenSSL used as well
+as that of the covered work.  */
+
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stdint.h>
+
+/* The id of an interned string.  0 is never used for a string.  */
+typedef uint32_t intern_id;
+
+intern_id intern (const char *);
+intern_id intern_lookup (const char *);
+char *intern_strdup (intern_id);
+intern_id intern_max_id (void);
+void intern_cleanup (void);
+
+/* Convert between ids and the keys or values of a hash table created
+   with hash_table_new (n, NULL, NULL).  */
+#define INTERN_TO_PTR(id) ((void *) (uintptr_t) (id))
+#define PTR_TO_INTERN(p) ((intern_id) (uintptr_t) (p))
+
+#endif /* INTERN_H */
@@ -96,6 +96,10 @@ static int shell_is_interactive;
    WARC writer.  If WARC writing is disabled, this is NULL.  */
 static FILE *warclogfp;
 
+/* If non-NULL, all the output, including the progress, is written to
+   this stream instead.  See log_capture_start.  */
+static FILE *capturefp;
+
 /* If true, it means logging is inhibited, i.e. nothing is printed or
    stored.  */
 static bool inhibit_logging;
@@ -317,6 +321,8 @@ get_log_fp (void)
 {
   if (inhibit_logging)
     return NULL;
+  if (capturefp)
+    return capturefp;
   if (logfp)
     return logfp;
   return stderr;
@@ -325,6 +331,8 @@ get_log_fp (void)
 static FILE *
 get_progress_fp (void)
 {
+  if (capturefp)
+    return get_log_fp ();
   if (opt.show_progress == true)
       return stderr;
   return get_log_fp();
@@ -357,6 +365,48 @@ log_set_warc_log_fp (FILE * fp)
   warclogfp = fp;
 }
 
+/* Send all the output to a temporary file from now on, dropping what
+   was captured before.  Worker processes call this at the start of
+   each job to collect its output, so that the main process can print
+   it in one piece (see log_capture_text).  If the temporary file
+   cannot be created, the output goes to the regular log.  */
+
+void
+log_capture_start (void)
+{
+  if (!capturefp)
+    capturefp = tmpfile ();
+  else
+    {
+      rewind (capturefp);
+      if (ftruncate (fileno (capturefp), 0) < 0)
+        DEBUGP (("Cannot truncate the captured log: %s\n",
+                 strerror (errno)));
+    }
+}
+
+/* Return a copy of the output captured since log_capture_start, or
+   NULL if there was none.  */
+
+char *
+log_capture_text (void)
+{
+  char *text;
+  long size;
+
+  if (!capturefp)
+    return NULL;
+  fflush (capturefp);
+  size = ftell (capturefp);
+  if (size <= 0)
+    return NULL;
+  text = xmalloc (size + 1);
+  rewind (capturefp);
+  size = fread (text, 1, size, capturefp);
+  text[size] = '\0';
+  return text;
+}
+
 /* Log a literal string S.  The string is logged as-is, without a
    newline appended.  */
 
@@ -278,6 +278,7 @@ static struct cmdline_option option_data[] =
 #ifdef HAVE_LIBCARES
     { "bind-dns-address", 0, OPT_VALUE, "binddnsaddress", -1 },
 #endif
+    { "bloom-filter", 0, OPT_BOOLEAN, "bloomfilter", -1 },
     { "body-data", 0, OPT_VALUE, "bodydata", -1 },
     { "body-file", 0, OPT_VALUE, "bodyfile", -1 },
     IF_SSL ( "ca-certificate", 0, OPT_VALUE, "cacertificate", -1 )
@@ -293,11 +294,14 @@ static struct cmdline_option option_data[] =
     { "config", 0, OPT_VALUE, "chooseconfig", -1 },
     { "connect-timeout", 0, OPT_VALUE, "connecttimeout", -1 },
     { "continue", 'c', OPT_BOOLEAN, "continue", -1 },
+    { "convert-early", 0, OPT_BOOLEAN, "convertearly", -1 },
     { "convert-file-only", 0, OPT_BOOLEAN, "convertfileonly", -1 },
     { "convert-links", 'k', OPT_BOOLEAN, "convertlinks", -1 },
     { "content-disposition", 0, OPT_BOOLEAN, "contentdisposition", -1 },
     { "content-on-error", 0, OPT_BOOLEAN, "contentonerror", -1 },
     { "cookies", 0, OPT_BOOLEAN, "cookies", -1 },
+    { "crawl-state", 0, OPT_VALUE, "crawlstate", -1 },
+    { "crawl-state-interval", 0, OPT_VALUE, "crawlstateinterval", -1 },
     IF_SSL ( "crl-file", 0, OPT_VALUE, "crlfile", -1 )
     { "cut-dirs", 0, OPT_VALUE, "cutdirs", -1 },
     { "debug", 'd', OPT_BOOLEAN, "debug", -1 },
@@ -306,6 +310,9 @@ static struct cmdline_option option_data[] =
     { "directories", 0, OPT_BOOLEAN, "dirstruct", -1 },
     { "directory-prefix", 'P', OPT_VALUE, "dirprefix", -1 },
     { "dns-cache", 0, OPT_BOOLEAN, "dnscache", -1 },
+    { "dns-cache-file", 0, OPT_VALUE, "dnscachefile", -1 },
+    { "dns-cache-size", 0, OPT_VALUE, "dnscachesize", -1 },
+    { "dns-cache-ttl", 0, OPT_VALUE, "dnscachettl", -1 },
 #ifdef HAVE_LIBCARES
     { "dns-servers", 0, OPT_VALUE, "dnsservers", -1 },
 #endif
@@ -317,6 +324,7 @@ static struct cmdline_option option_data[] =
     { "exclude-directories", 'X', OPT_VALUE, "excludedirectories", -1 },
     { "exclude-domains", 0, OPT_VALUE, "excludedomains", -1 },
     { "execute", 'e', OPT__EXECUTE, NULL, required_argument },
+    { "flush-interval", 0, OPT_VALUE, "flushinterval", -1 },
     { "follow-ftp", 0, OPT_BOOLEAN, "followftp", -1 },
     { "follow-tags", 0, OPT_VALUE, "followtags", -1 },
     { "force-directories", 'x', OPT_BOOLEAN, "dirstruct", -1 },
@@ -343,6 +351,7 @@ static struct cmdline_option option_data[] =
     { "http-keep-alive", 0, OPT_BOOLEAN, "httpkeepalive", -1 },
     { "http-passwd", 0, OPT_VALUE, "httppassword", -1 }, /* deprecated */
     { "http-password", 0, OPT_VALUE, "httppassword", -1 },
+    { "http-pipeline", 0, OPT_VALUE, "httppipeline", -1 },
     { "http-user", 0, OPT_VALUE, "httpuser", -1 },
     IF_SSL ( "https-only", 0, OPT_BOOLEAN, "httpsonly", -1 )
     { "ignore-case", 0, OPT_BOOLEAN, "ignorecase", -1 },
@@ -358,6 +367,7 @@ static struct cmdline_option option_data[] =
     { "input-metalink", 0, OPT_VALUE, "inputmetalink", -1 },
 #endif
     { "iri", 0, OPT_BOOLEAN, "iri", -1 },
+    { "keep-alive-timeout", 0, OPT_VALUE, "keepalivetimeout", -1 },
     { "keep-badhash", 0, OPT_BOOLEAN, "keepbadhash", -1 },
     { "keep-session-cookies", 0, OPT_BOOLEAN, "keepsessioncookies", -1 },
     { "level", 'l', OPT_VALUE, "reclevel", -1 },
@@ -365,6 +375,7 @@ static struct cmdline_option option_data[] =
     { "load-cookies", 0, OPT_VALUE, "loadcookies", -1 },
     { "local-encoding", 0, OPT_VALUE, "localencoding", -1 },
     { "rejected-log", 0, OPT_VALUE, "rejectedlog", -1 },
+    { "max-idle-connections", 0, OPT_VALUE, "maxidleconnections", -1 },
     { "max-redirect", 0, OPT_VALUE, "maxredirect", -1 },
 #ifdef HAVE_METALINK
     { "metalink-index", 0, OPT_VALUE, "metalinkindex", -1 },
@@ -380,6 +391,7 @@ static struct cmdline_option option_data[] =
     { "output-document", 'O', OPT_VALUE, "outputdocument", -1 },
     { "output-file", 'o', OPT_VALUE, "logfile", -1 },
     { "page-requisites", 'p', OPT_BOOLEAN, "pagerequisites", -1 },
+    { "parallel", 0, OPT_VALUE, "parallel", -1 },
     { "parent", 0, OPT__PARENT, NULL, optional_argument },
     { "passive-ftp", 0, OPT_BOOLEAN, "passiveftp", -1 },
     { "password", 0, OPT_VALUE, "password", -1 },
@@ -402,10 +414,12 @@ static struct cmdline_option option_data[] =
     { "proxy-passwd", 0, OPT_VALUE, "proxypassword", -1 }, /* deprecated */
     { "proxy-password", 0, OPT_VALUE, "proxypassword", -1 },
     { "proxy-user", 0, OPT_VALUE, "proxyuser", -1 },
+    { "queue-memory", 0, OPT_VALUE, "queuememory", -1 },
     { "quiet", 'q', OPT_BOOLEAN, "quiet", -1 },
     { "quota", 'Q', OPT_VALUE, "quota", -1 },
     { "random-file", 0, OPT_VALUE, "randomfile", -1 },
     { "random-wait", 0, OPT_BOOLEAN, "randomwait", -1 },
+    { "read-buffer", 0, OPT_VALUE, "readbuffer", -1 },
     { "read-timeout", 0, OPT_VALUE, "readtimeout", -1 },
     { "recursive", 'r', OPT_BOOLEAN, "recursive", -1 },
     { "referer", 0, OPT_VALUE, "referer", -1 },
@@ -423,6 +437,7 @@ static struct cmdline_option option_data[] =
     { "retry-on-http-error", 0, OPT_VALUE, "retryonhttperror", -1 },
     { "save-cookies", 0, OPT_VALUE, "savecookies", -1 },
     { "save-headers", 0, OPT_BOOLEAN, "saveheaders", -1 },
+    { "segments", 0, OPT_VALUE, "segments", -1 },
     IF_SSL ( "secure-protocol", 0, OPT_VALUE, "secureprotocol", -1 )
     { "server-response", 'S', OPT_BOOLEAN, "serverresponse", -1 },
     { "span-hosts", 'H', OPT_BOOLEAN, "spanhosts", -1 },
@@ -448,6 +463,7 @@ static struct cmdline_option option_data[] =
     { "warc-cdx", 0, OPT_BOOLEAN, "warccdx", -1 },
 #ifdef HAVE_LIBZ
     { "warc-compression", 0, OPT_BOOLEAN, "warccompression", -1 },
+    { "warc-compression-threads", 0, OPT_VALUE, "warccompressionthreads", -1 },
 #endif
     { "warc-dedup", 0, OPT_VALUE, "warccdxdedup", -1 },
     { "warc-digests", 0, OPT_BOOLEAN, "warcdigests", -1 },
@@ -459,6 +475,7 @@ static struct cmdline_option option_data[] =
 #ifdef USE_WATT32
     { "wdebug", 0, OPT_BOOLEAN, "wdebug", -1 },
 #endif
+    { "write-buffer", 0, OPT_VALUE, "writebuffer", -1 },
 #ifdef ENABLE_XATTR
     { "xattr", 0, OPT_BOOLEAN, "xattr", -1 },
 #endif
@@ -661,6 +678,8 @@ Download:\n"),
   -c,  --continue                  resume getting a partially-downloaded file\n"),
     N_("\
        --start-pos=OFFSET          start downloading from zero-based position OFFSET\n"),
+    N_("\
+       --segments=N                download large files over N connections\n"),
     N_("\
        --progress=TYPE             select progress gauge type\n"),
     N_("\
@@ -709,8 +728,20 @@ Download:\n"),
        --bind-address=ADDRESS      bind to ADDRESS (hostname or IP) on local host\n"),
     N_("\
        --limit-rate=RATE           limit download rate to RATE\n"),
+    N_("\
+       --read-buffer=SIZE          read up to SIZE bytes from the network at once\n"),
+    N_("\
+       --write-buffer=SIZE         buffer up to SIZE bytes before writing to disk\n"),
+    N_("\
+       --flush-interval=SECS       write buffered data to disk every SECS seconds\n"),
     N_("\
        --no-dns-cache              disable caching DNS lookups\n"),
+    N_("\
+       --dns-cache-file=FILE       keep DNS lookups in FILE between runs\n"),
+    N_("\
+       --dns-cache-size=NUMBER     cache the addresses of at most NUMBER hosts\n"),
+    N_("\
+       --dns-cache-ttl=SECS        consider cached DNS lookups valid for SECS\n"),
     N_("\
        --restrict-file-names=OS    restrict chars in file names to ones OS allows\n"),
     N_("\
@@ -812,6 +843,12 @@ HTTP options:\n"),
   -U,  --user-agent=AGENT          identify as AGENT instead of Wget/VERSION\n"),
     N_("\
        --no-http-keep-alive        disable HTTP keep-alive (persistent connections)\n"),
+    N_("\
+       --max-idle-connections=N    keep up to N idle connections for reuse\n"),
+    N_("\
+       --keep-alive-timeout=SECS   don't reuse connections idle for over SECS\n"),
+    N_("\
+       --http-pipeline=N           send up to N requests ahead on a connection\n"),
     N_("\
        --no-cookies                don't use cookies\n"),
     N_("\
@@ -946,6 +983,8 @@ WARC options:\n"),
 #ifdef HAVE_LIBZ
     N_("\
        --no-warc-compression       do not compress WARC files with GZIP\n"),
+    N_("\
+       --warc-compression-threads=N  compress WARC records in N threads\n"),
 #endif
     N_("\
        --no-warc-digests           do not calculate SHA1 digests\n"),
@@ -969,6 +1008,9 @@ Recursive download:\n"),
                                      local files\n"),
     N_("\
        --convert-file-only         convert the file part of the URLs only (usually known as the basename)\n"),
+    N_("\
+       --convert-early             with -k, remember the links of each document\n\
+                                     so as not to parse it again to convert it\n"),
     N_("\
        --backups=N                 before writing file X, rotate up to N backup files\n"),
 
@@ -983,6 +1025,19 @@ Recursive download:\n"),
   -m,  --mirror                    shortcut for -N -r -l inf --no-remove-listing\n"),
     N_("\
   -p,  --page-requisites           get all images, etc. needed to display HTML page\n"),
+    N_("\
+       --parallel=NUMBER           download up to NUMBER files at once\n"),
+    N_("\
+       --queue-memory=NUMBER       keep at most NUMBER queued URLs in memory\n"),
+    N_("\
+       --bloom-filter              check new links against a Bloom filter of\n\
+                                     the URLs already seen\n"),
+    N_("\
+       --crawl-state=FILE          save the state of the crawl to FILE and\n\
+                                     resume from it\n"),
+    N_("\
+       --crawl-state-interval=SECS save the state of the crawl every SECS\n\
+                                     seconds\n"),
     N_("\
        --strict-comments           turn on strict (SGML) handling of HTML comments\n"),
     "\n",
@@ -1735,6 +1790,25 @@ for details.\n\n"));
         }
     }
 
+  if (!opt.convert_links && !opt.convert_file_only)
+    opt.convert_early = false;
+  if (opt.convert_early && opt.crawl_state)
+    {
+      fprintf (stderr,
+               _("--convert-early does not work with --crawl-state,"
+                 " it will be disabled.\n"));
+      opt.convert_early = false;
+    }
+
+  if (opt.parallel > 1
+      && (opt.warc_filename || opt.output_document || opt.spider))
+    {
+      fprintf (stderr,
+               _("--parallel does not work with --warc-file, -O or --spider,"
+                 " it will be disabled.\n"));
+      opt.parallel = 0;
+    }
+
 #ifdef HAVE_LIBZ
   if (opt.always_rest || opt.start_pos >= 0)
     {
@@ -2293,6 +2367,12 @@ only if outputting to a regular file.\n"));
     save_hsts ();
 #endif
 
+  if (opt.dns_cache_file)
+    host_cache_save ();
+
+  if (opt.crawl_state)
+    crawl_state_finish ();
+
   if ((opt.convert_links || opt.convert_file_only) && !opt.delete_after)
     convert_all_links ();
 
@@ -688,6 +688,13 @@ openssl_poll (int fd, double timeout, int wait_for, void *arg)
   return select_fd (fd, timeout, wait_for);
 }
 
+static int
+openssl_pending (int fd _GL_UNUSED, void *arg)
+{
+  struct openssl_transport_context *ctx = arg;
+  return SSL_pending (ctx->conn);
+}
+
 static int
 openssl_peek (int fd, char *buf, int bufsize, void *arg, double timeout)
 {
@@ -764,7 +771,8 @@ openssl_close (int fd, void *arg)
 
 static struct transport_implementation openssl_transport = {
   openssl_read, openssl_write, openssl_poll,
-  openssl_peek, openssl_errstr, openssl_close
+  openssl_peek, openssl_errstr, openssl_close,
+  openssl_pending
 };
 
 static const char *
@@ -55,6 +55,15 @@ struct options
   bool no_parent;               /* Restrict access to the parent
                                    directory.  */
   int reclevel;                 /* Maximum level of recursion */
+  int parallel;                 /* Number of downloads run in parallel
+                                   during recursive retrieval. */
+  int queue_memory;             /* Number of queued URLs kept in memory;
+                                   the rest goes to temporary files. */
+  bool bloom_filter;            /* Front the URLs seen with a Bloom
+                                   filter. */
+  char *crawl_state;            /* File the state of the crawl is saved
+                                   to and restored from. */
+  double crawl_state_interval;  /* How often to save it. */
   bool dirstruct;               /* Do we build the directory structure
                                    as we go along? */
   bool no_dirstruct;            /* Do we hate dirstruct? */
@@ -109,6 +118,12 @@ struct options
   char **domains;               /* See host.c */
   char **exclude_domains;
   bool dns_cache;               /* whether we cache DNS lookups. */
+  char *dns_cache_file;         /* file to keep DNS lookups in
+                                   between runs. */
+  int dns_cache_size;           /* maximum number of hosts in the
+                                   DNS cache, 0 for no limit. */
+  double dns_cache_ttl;         /* how long cached DNS lookups
+                                   stay valid, 0 for ever. */
 
   char **follow_tags;           /* List of HTML tags to recursively follow. */
   char **ignore_tags;           /* List of HTML tags to ignore if recursing. */
@@ -124,6 +139,8 @@ struct options
   char *warc_cdx_dedup_filename;/* CDX file to be used for deduplication. */
   wgint warc_maxsize;           /* WARC max archive size */
   bool warc_compression_enabled;/* For GZIP compression. */
+  int warc_compression_threads; /* Threads compressing WARC records
+                                   in the background, or 0. */
   bool warc_digests_enabled;    /* For SHA1 digests. */
   bool warc_cdx_enabled;        /* Create CDX files? */
   bool warc_keep_log;           /* Store the log file in a WARC record. */
@@ -148,6 +165,12 @@ struct options
   char *http_passwd;            /* HTTP password. */
   char **user_headers;          /* User-defined header(s). */
   bool http_keep_alive;         /* whether we use keep-alive */
+  int max_idle_connections;     /* How many idle keep-alive connections
+                                   to keep for reuse. */
+  double keep_alive_timeout;    /* How long an idle keep-alive
+                                   connection may be reused. */
+  int http_pipeline;            /* How many requests to pipeline on a
+                                   keep-alive connection. */
 
   bool use_proxy;               /* Do we use proxy? */
   bool allow_cache;             /* Do we allow server-side caching? */
@@ -171,6 +194,14 @@ struct options
 
   wgint limit_rate;             /* Limit the download rate to this
                                    many bps. */
+  wgint read_buffer;            /* The largest read from the network
+                                   fd_read_body may grow to. */
+  int segments;                 /* Split large downloads into this
+                                   many parallel ranges. */
+  wgint write_buffer;           /* How much downloaded data to buffer
+                                   before writing it to disk. */
+  double flush_interval;        /* How long buffered data may wait
+                                   before it is written to disk. */
   SUM_SIZE_INT quota;           /* Maximum file size to download and
                                    store. */
 
@@ -201,6 +232,8 @@ struct options
                                    locally? */
   bool convert_file_only;       /* Convert only the file portion of the URI (i.e. basename).
                                    Leave everything else untouched. */
+  bool convert_early;           /* Convert the links of each document
+                                   as soon as it has been parsed? */
 
   bool remove_listing;          /* Do we remove .listing files
                                    generated by FTP? */
@@ -50,12 +50,24 @@ as that of the covered work.  */
 #include "css-url.h"
 #include "spider.h"
 #include "exits.h"
+#include "http.h"
+#include "progress.h"
+#include "workers.h"
+#include "intern.h"
+#include "ptimer.h"
 
-/* Functions for maintaining the URL queue.  */
+/* Functions for maintaining the URL queue.
+
+   A large crawl can still find more URLs than fit in memory, so only
+   the two ends of the queue are kept there: the URLs about to be
+   dequeued and the ones most recently enqueued.  When the latter
+   grow past half of opt.queue_memory, they are written to temporary
+   "spill" files, in order, and read back when the head of the queue
+   runs out.  The order of the queue is thus preserved.  */
 
 struct queue_element {
-  const char *url;              /* the URL to download */
-  const char *referer;          /* the referring document */
+  char *url;                    /* the URL to download */
+  char *referer;                /* the referring document, or NULL */
   int depth;                    /* the depth */
   bool html_allowed;            /* whether the document is allowed to
                                    be treated as HTML. */
@@ -65,9 +77,29 @@ struct queue_element {
   struct queue_element *next;   /* next element in queue */
 };
 
+/* A temporary file holding a part of the queue. */
+struct spill_file {
+  FILE *fp;
+  int count;                    /* number of URLs left in the file */
+  long size;                    /* number of bytes written */
+  bool reading;                 /* whether URLs are being read back; no
+                                   more are appended then */
+  struct spill_file *next;
+};
+
+/* Spill files are not appended to beyond this size, so that the disk
+   space of the URLs that have been read back is released early.  */
+#define SPILL_FILE_SIZE (64 * 1024 * 1024)
+
 struct url_queue {
-  struct queue_element *head;
+  struct queue_element *head;   /* the URLs to be dequeued first */
+  struct spill_file *spill_head; /* then the ones in these files */
+  struct spill_file *spill_tail;
+  struct queue_element *back;   /* then the most recently enqueued */
   struct queue_element *tail;
+  int back_count;               /* number of elements from BACK on */
+  bool spill_failed;            /* set when a spill file couldn't be
+                                   written */
   int count, maxcount;
 };
 
@@ -80,17 +112,282 @@ url_queue_new (void)
   return queue;
 }
 
-/* Delete a URL queue. */
+static void
+free_queue_elements (struct queue_element *qel)
+{
+  while (qel)
+    {
+      struct queue_element *next = qel->next;
+      iri_free (qel->iri);
+      xfree (qel->url);
+      xfree (qel->referer);
+      xfree (qel);
+      qel = next;
+    }
+}
+
+/* Remove all the URLs from a URL queue. */
+
+static void
+url_queue_clear (struct url_queue *queue)
+{
+  free_queue_elements (queue->head);
+  free_queue_elements (queue->back);
+  while (queue->spill_head)
+    {
+      struct spill_file *sf = queue->spill_head;
+      queue->spill_head = sf->next;
+      fclose (sf->fp);
+      xfree (sf);
+    }
+  xzero (*queue);
+}
+
+/* Delete a URL queue, along with the URLs left in it. */
 
 static void
 url_queue_delete (struct url_queue *queue)
 {
+  url_queue_clear (queue);
   xfree (queue);
 }
 
+/* The format of the spill files.  Each URL is stored as a record of
+   numbers and strings (see fput_number and fput_string), in this
+   order:
+
+     the URL
+     the referer, or NULL
+     the depth
+     flags: 1 = html_allowed, 2 = css_allowed, 4 = iri->utf8_encode
+     iri->uri_encoding, or NULL
+     iri->content_encoding, or NULL  */
+
+static void
+spill_put_record (FILE *fp, const char *url, const char *referer,
+                  int depth, bool html_allowed, bool css_allowed,
+                  const struct iri *iri)
+{
+  fput_string (fp, url);
+  fput_string (fp, referer);
+  fput_number (fp, depth);
+  fput_number (fp, (html_allowed ? 1 : 0)
+                    | (css_allowed ? 2 : 0)
+                    | (iri && iri->utf8_encode ? 4 : 0));
+#ifdef ENABLE_IRI
+  fput_string (fp, iri ? iri->uri_encoding : NULL);
+  fput_string (fp, iri ? iri->content_encoding : NULL);
+#else
+  fput_string (fp, NULL);
+  fput_string (fp, NULL);
+#endif
+}
+
+static void
+spill_put_element (FILE *fp, const struct queue_element *qel)
+{
+  spill_put_record (fp, qel->url, qel->referer, qel->depth,
+                    qel->html_allowed, qel->css_allowed, qel->iri);
+}
+
+/* Read the next record from FP into a new queue element.  Returns
+   NULL if the record could not be read.  */
+
+static struct queue_element *
+spill_get_element (FILE *fp)
+{
+  struct queue_element *qel;
+  char *url, *referer;
+  char *uri_encoding = NULL, *content_encoding = NULL;
+  unsigned long depth, flags;
+  bool ok;
+
+  ok = fget_string (fp, &url) && url
+    && fget_string (fp, &referer);
+  if (!ok)
+    {
+      xfree (url);
+      return NULL;
+    }
+  ok = fget_number (fp, &depth)
+    && fget_number (fp, &flags)
+    && fget_string (fp, &uri_encoding)
+    && fget_string (fp, &content_encoding);
+  if (!ok)
+    {
+      xfree (url);
+      xfree (referer);
+      xfree (uri_encoding);
+      return NULL;
+    }
+
+  qel = xnew0 (struct queue_element);
+  qel->url = url;
+  qel->referer = referer;
+  qel->depth = depth;
+  qel->html_allowed = (flags & 1) != 0;
+  qel->css_allowed = (flags & 2) != 0;
+  qel->iri = iri_new ();
+#ifdef ENABLE_IRI
+  xfree (qel->iri->uri_encoding);
+  qel->iri->uri_encoding = uri_encoding;
+  qel->iri->content_encoding = content_encoding;
+  qel->iri->utf8_encode = (flags & 4) != 0;
+#else
+  xfree (uri_encoding);
+  xfree (content_encoding);
+#endif
+  return qel;
+}
+
+/* Move the elements from BACK on to a spill file.  If that fails, they
+   are left where they are and spilling is turned off.  */
+
+static void
+spill_back (struct url_queue *queue)
+{
+  struct spill_file *sf = queue->spill_tail;
+  struct queue_element *qel;
+
+  if (!sf || sf->reading || sf->size >= SPILL_FILE_SIZE)
+    {
+      FILE *fp = tmpfile ();
+      if (!fp)
+        {
+          logprintf (LOG_NOTQUIET,
+                     _("Cannot create a temporary file for the URL queue: %s\n"),
+                     strerror (errno));
+          queue->spill_failed = true;
+          return;
+        }
+      sf = xnew0 (struct spill_file);
+      sf->fp = fp;
+      if (queue->spill_tail)
+        queue->spill_tail->next = sf;
+      else
+        queue->spill_head = sf;
+      queue->spill_tail = sf;
+    }
+
+  for (qel = queue->back; qel; qel = qel->next)
+    spill_put_element (sf->fp, qel);
+  if (fflush (sf->fp) != 0 || ferror (sf->fp))
+    {
+      /* The records written so far are past SF->count and will never
+         be read.  */
+      logprintf (LOG_NOTQUIET,
+                 _("Cannot write the URL queue to a temporary file: %s\n"),
+                 strerror (errno));
+      queue->spill_failed = true;
+      return;
+    }
+
+  sf->count += queue->back_count;
+  sf->size = ftell (sf->fp);
+  DEBUGP (("Spilled %d queued URLs to disk.\n", queue->back_count));
+  free_queue_elements (queue->back);
+  queue->back = queue->tail = NULL;
+  queue->back_count = 0;
+}
+
+/* Read the next part of the queue from the spill files to HEAD. */
+
+static void
+spill_read (struct url_queue *queue)
+{
+  struct queue_element *last = NULL;
+  int batch = MAX (opt.queue_memory / 2, 1);
+  int n = 0;
+
+  while (queue->spill_head && n < batch)
+    {
+      struct spill_file *sf = queue->spill_head;
+
+      if (!sf->reading)
+        {
+          rewind (sf->fp);
+          sf->reading = true;
+        }
+      while (sf->count > 0 && n < batch)
+        {
+          struct queue_element *qel = spill_get_element (sf->fp);
+          if (!qel)
+            {
+              logprintf (LOG_NOTQUIET,
+                         _("Cannot read the URL queue from a temporary file;"
+                           " %d URLs are lost.\n"), sf->count);
+              queue->count -= sf->count;
+              sf->count = 0;
+              break;
+            }
+          if (last)
+            last->next = qel;
+          else
+            queue->head = qel;
+          last = qel;
+          --sf->count;
+          ++n;
+        }
+      if (sf->count == 0)
+        {
+          queue->spill_head = sf->next;
+          if (!queue->spill_head)
+            queue->spill_tail = NULL;
+          fclose (sf->fp);
+          xfree (sf);
+        }
+    }
+}
+
+/* Return the element at the head of QUEUE, making sure it is in
+   memory, or NULL if the queue is empty.  */
+
+static struct queue_element *
+url_queue_front (struct url_queue *queue)
+{
+  if (!queue->head && queue->spill_head)
+    spill_read (queue);
+  if (!queue->head)
+    {
+      queue->head = queue->back;
+      queue->back = queue->tail = NULL;
+      queue->back_count = 0;
+    }
+  return queue->head;
+}
+
+/* Add QEL to the end of QUEUE, spilling the recent URLs to disk if
+   there are too many of them.  */
+
+static void
+url_queue_append (struct url_queue *queue, struct queue_element *qel)
+{
+  ++queue->count;
+  if (queue->count > queue->maxcount)
+    queue->maxcount = queue->count;
+
+  if (queue->tail)
+    queue->tail->next = qel;
+  else
+    queue->back = qel;
+  queue->tail = qel;
+  ++queue->back_count;
+
+  if (opt.queue_memory > 0 && !queue->spill_failed
+      && queue->back_count >= MAX (opt.queue_memory / 2, 1))
+    {
+      /* If nothing is ahead of them, the recent URLs simply become
+         the head of the queue.  */
+      if (!queue->head && !queue->spill_head)
+        url_queue_front (queue);
+      else
+        spill_back (queue);
+    }
+}
+
 /* Enqueue a URL in the queue.  The queue is FIFO: the items will be
    retrieved ("dequeued") from the queue in the order they were placed
-   into it.  */
+   into it.  URL and REFERER are not taken over by the queue.  */
 
 static void
 url_enqueue (struct url_queue *queue, struct iri *i,
@@ -99,49 +396,40 @@ url_enqueue (struct url_queue *queue, struct iri *i,
 {
   struct queue_element *qel = xnew (struct queue_element);
   qel->iri = i;
-  qel->url = url;
-  qel->referer = referer;
+  qel->url = xstrdup (url);
+  qel->referer = referer ? xstrdup (referer) : NULL;
   qel->depth = depth;
   qel->html_allowed = html_allowed;
   qel->css_allowed = css_allowed;
   qel->next = NULL;
 
-  ++queue->count;
-  if (queue->count > queue->maxcount)
-    queue->maxcount = queue->count;
-
   DEBUGP (("Enqueuing %s at depth %d\n",
            quotearg_n_style (0, escape_quoting_style, url), depth));
-  DEBUGP (("Queue count %d, maxcount %d.\n", queue->count, queue->maxcount));
-
   if (i)
     DEBUGP (("[IRI Enqueuing %s with %s\n", quote_n (0, url),
              i->uri_encoding ? quote_n (1, i->uri_encoding) : "None"));
 
-  if (queue->tail)
-    queue->tail->next = qel;
-  queue->tail = qel;
+  /* QEL, and I with it, may be written out and freed here.  */
+  url_queue_append (queue, qel);
 
-  if (!queue->head)
-    queue->head = queue->tail;
+  DEBUGP (("Queue count %d, maxcount %d.\n", queue->count, queue->maxcount));
 }
 
 /* Take a URL out of the queue.  Return true if this operation
-   succeeded, or false if the queue is empty.  */
+   succeeded, or false if the queue is empty.  The returned URL and
+   REFERER are freshly allocated.  */
 
 static bool
 url_dequeue (struct url_queue *queue, struct iri **i,
-             const char **url, const char **referer, int *depth,
+             char **url, char **referer, int *depth,
              bool *html_allowed, bool *css_allowed)
 {
-  struct queue_element *qel = queue->head;
+  struct queue_element *qel = url_queue_front (queue);
 
   if (!qel)
     return false;
 
-  queue->head = queue->head->next;
-  if (!queue->head)
-    queue->tail = NULL;
+  queue->head = qel->next;
 
   *i = qel->iri;
   *url = qel->url;
@@ -153,32 +441,926 @@ url_dequeue (struct url_queue *queue, struct iri **i,
   --queue->count;
 
   DEBUGP (("Dequeuing %s at depth %d\n",
-           quotearg_n_style (0, escape_quoting_style, qel->url), qel->depth));
+           quotearg_n_style (0, escape_quoting_style, *url), qel->depth));
   DEBUGP (("Queue count %d, maxcount %d.\n", queue->count, queue->maxcount));
 
   xfree (qel);
   return true;
 }
 
-static void blacklist_add (struct hash_table *blacklist, const char *url)
+/* The blacklist is a bitmap indexed by the interned ids of the
+   unescaped URLs.
+
+   Looking up a link walks all its segments through the intern store,
+   even if the link is new.  With --bloom-filter, the bitmap is
+   fronted by a blocked Bloom filter: each URL sets BLOOM_HASHES bits
+   within a single 64-byte block of the filter, so a lookup costs one
+   hash of the URL and one cache line, and a URL that misses any of
+   its bits is certainly not in the blacklist.  The filter is kept at
+   about BLOOM_BITS_PER_URL bits per URL, for a false positive rate of
+   about 1%, and is rebuilt from the bitmap when it gets full.  It
+   pays off when most links are new; when most are duplicates it is
+   one more cache line per lookup, hence the option.  */
+
+#define BLOOM_BLOCK_WORDS 8     /* 64-bit words per block */
+#define BLOOM_HASHES 6
+#define BLOOM_BITS_PER_URL 10
+
+struct blacklist {
+  unsigned char *bits;
+  intern_id size;               /* number of ids the bitmap covers */
+  intern_id count;              /* number of ids set in the bitmap */
+  uint64_t *filter;
+  uint32_t filter_blocks;       /* number of blocks, a power of two */
+};
+
+/* Set the bits of HASH in FILTER, or check whether they are all set.
+   The lowest bits of HASH choose the block, and the bits of HASH
+   mixed once more choose the BLOOM_HASHES bits in it, nine bits
+   each.  */
+
+static bool
+bloom_probe (uint64_t *filter, uint32_t blocks, uint64_t hash, bool add)
+{
+  uint64_t *block = filter + (hash & (blocks - 1)) * BLOOM_BLOCK_WORDS;
+  uint64_t bits = (hash ^ (hash >> 31)) * 0x94d049bb133111ebull;
+  int k;
+
+  for (k = 0; k < BLOOM_HASHES; k++, bits >>= 9)
+    {
+      uint64_t mask = (uint64_t) 1 << (bits & 63);
+      uint64_t *word = block + ((bits >> 6) & (BLOOM_BLOCK_WORDS - 1));
+      if (add)
+        *word |= mask;
+      else if (!(*word & mask))
+        return false;
+    }
+  return true;
+}
+
+/* Make the filter of BLACKLIST large enough for one more URL,
+   rebuilding it from the bitmap if it has to grow.  */
+
+static void
+bloom_reserve (struct blacklist *blacklist)
+{
+  uint32_t blocks = blacklist->filter_blocks;
+  intern_id id;
+
+  if (blocks
+      && (uint64_t) (blacklist->count + 1) * BLOOM_BITS_PER_URL
+         <= (uint64_t) blocks * BLOOM_BLOCK_WORDS * 64)
+    return;
+
+  blocks = blocks ? blocks * 2 : 64;
+  xfree (blacklist->filter);
+  blacklist->filter = xcalloc (blocks, BLOOM_BLOCK_WORDS * sizeof (uint64_t));
+  blacklist->filter_blocks = blocks;
+
+  for (id = 1; id < blacklist->size; id++)
+    if (blacklist->bits[id / 8] & (1 << (id % 8)))
+      {
+        char *url = intern_strdup (id);
+        bloom_probe (blacklist->filter, blocks, hash_string (url), true);
+        xfree (url);
+      }
+}
+
+/* A URL as looked up in the blacklist: its unescaped form and the
+   hash of that, which is also the hash of the filter.  It is prepared
+   once per link and used both to check and to add the link.  */
+
+struct blacklist_key {
+  const char *key;
+  char *copy;                   /* the unescaped copy to free, or NULL */
+  unsigned long hash;
+};
+
+/* Prepare the key of URL.  Most URLs have nothing to unescape, which
+   spares the copy.  */
+
+static void
+blacklist_key_init (struct blacklist_key *bk, const char *url)
+{
+  bk->copy = NULL;
+  if (strchr (url, '%'))
+    {
+      bk->copy = xstrdup (url);
+      url_unescape (bk->copy);
+      url = bk->copy;
+    }
+  bk->key = url;
+  bk->hash = hash_string (url);
+}
+
+static void
+blacklist_key_free (struct blacklist_key *bk)
+{
+  xfree (bk->copy);
+}
+
+/* Add the unescaped URL KEY, whose hash_string is HASH, to
+   BLACKLIST.  */
+
+static void
+blacklist_insert (struct blacklist *blacklist, const char *key,
+                  unsigned long hash)
+{
+  intern_id id = intern (key);
+
+  if (id >= blacklist->size)
+    {
+      intern_id size = MAX (intern_max_id () + 1, blacklist->size * 2);
+      size = (size + 7) & ~7;
+      blacklist->bits = xrealloc (blacklist->bits, size / 8);
+      memset (blacklist->bits + blacklist->size / 8, 0,
+              (size - blacklist->size) / 8);
+      blacklist->size = size;
+    }
+  if (blacklist->bits[id / 8] & (1 << (id % 8)))
+    return;
+
+  if (opt.bloom_filter)
+    {
+      bloom_reserve (blacklist);
+      bloom_probe (blacklist->filter, blacklist->filter_blocks, hash, true);
+    }
+  blacklist->bits[id / 8] |= 1 << (id % 8);
+  ++blacklist->count;
+}
+
+static void
+blacklist_add_key (struct blacklist *blacklist, const struct blacklist_key *bk)
+{
+  blacklist_insert (blacklist, bk->key, bk->hash);
+}
+
+static void blacklist_add (struct blacklist *blacklist, const char *url)
+{
+  struct blacklist_key bk;
+
+  blacklist_key_init (&bk, url);
+  blacklist_add_key (blacklist, &bk);
+  blacklist_key_free (&bk);
+}
+
+static bool
+blacklist_contains (struct blacklist *blacklist,
+                    const struct blacklist_key *bk)
 {
-  char *url_unescaped = xstrdup (url);
+  intern_id id;
+
+  if (!blacklist->count
+      || (blacklist->filter
+          && !bloom_probe (blacklist->filter, blacklist->filter_blocks,
+                           bk->hash, false)))
+    return false;
 
-  url_unescape (url_unescaped);
-  string_set_add (blacklist, url_unescaped);
-  xfree (url_unescaped);
+  id = intern_lookup (bk->key);
+  return id && id < blacklist->size
+    && (blacklist->bits[id / 8] & (1 << (id % 8)));
 }
 
-static int blacklist_contains (struct hash_table *blacklist, const char *url)
+static void
+blacklist_free (struct blacklist *blacklist)
 {
-  char *url_unescaped = xstrdup(url);
-  int ret;
+  xfree (blacklist->bits);
+  xfree (blacklist->filter);
+  xzero (*blacklist);
+}
 
-  url_unescape (url_unescaped);
-  ret = string_set_contains (blacklist, url_unescaped);
-  xfree (url_unescaped);
+/* Parallel retrieval.  With --parallel=N, the downloads are done by a
+   pool of N worker processes (see workers.c) while the main process
+   keeps walking the tree: it owns the queue and the blacklist, parses
+   the downloaded documents and registers the downloads for link
+   conversion.  The URLs at the head of the queue are handed to the
+   workers as they become idle, but their results are processed
+   strictly in queue order.  That way the traversal, the depth limits
+   and the reject log are exactly the same as without --parallel, and
+   the output of each download is printed in one piece.  */
+
+/* A URL taken from the queue, along with the state of its download. */
+
+struct pending {
+  struct iri *iri;
+  char *url;
+  char *referer;
+  int depth;
+  bool html_allowed;
+  bool css_allowed;
+
+  int job;                      /* id of the worker job downloading the
+                                   URL, or -1 if the main process is to
+                                   do it itself. */
+  bool done;                    /* whether REPLY holds the results */
+  struct wmsg reply;            /* results of the job */
+
+  struct pending *next;
+};
 
-  return ret;
+struct download_slots {
+  struct worker_pool *pool;
+  struct pending *head, *tail;  /* URLs dequeued but not yet processed,
+                                   in queue order */
+  int count;
+};
+
+/* Whether this worker process has been set up for downloading. */
+static bool worker_ready;
+
+/* Download a URL in a worker process.  This runs retrieve_url just
+   like retrieve_tree would, and sends back everything retrieve_tree
+   needs to know, as well as what retrieve_url recorded in the state
+   of the worker that the main process must know about.  */
+
+static void
+parallel_retrieve (struct wmsg *job, struct wmsg *reply)
+{
+  char *url = msg_get_string (job);
+  char *referer = msg_get_string (job);
+  char *file = NULL, *redirected = NULL, *log_text = NULL;
+  struct iri *i = iri_new ();
+  struct url *url_parsed;
+  int dt = 0, url_err;
+  int numurls_before = numurls;
+  SUM_SIZE_INT bytes_before = total_downloaded_bytes;
+  double time_before = total_download_time;
+  downloaded_file_t downloaded = FILE_NOT_ALREADY_DOWNLOADED;
+  uerr_t status = URLERROR;
+
+#ifdef ENABLE_IRI
+  i->uri_encoding = msg_get_string (job);
+  i->content_encoding = msg_get_string (job);
+  i->utf8_encode = msg_get_number (job);
+#endif
+
+  if (!worker_ready)
+    {
+      /* The connections kept alive by the main process are not ours
+         to use.  */
+      http_forget_connections ();
+      /* The main process looks for the links of what is downloaded
+         here, in the files.  */
+      links_stream_disable ();
+      /* The progress bar doesn't make sense in a log printed after
+         the fact.  */
+      set_progress_implementation ("dot");
+      worker_ready = true;
+    }
+  log_capture_start ();
+
+  url_parsed = url_parse (url, &url_err, i, true);
+  if (url_parsed)
+    {
+      status = retrieve_url (url_parsed, url, &file, &redirected, referer,
+                             &dt, false, i, true);
+      if (file)
+        downloaded = downloaded_file (CHECK_FOR_FILE, file);
+    }
+
+  log_text = log_capture_text ();
+
+  msg_put_string (reply, log_text);
+  msg_put_number (reply, status);
+  msg_put_number (reply, dt);
+  msg_put_string (reply, file);
+  msg_put_string (reply, redirected);
+  msg_put_string (reply, redirected ? redirected
+                  : url_parsed ? url_parsed->url : NULL);
+#ifdef ENABLE_IRI
+  msg_put_string (reply, i->uri_encoding);
+  msg_put_string (reply, i->content_encoding);
+  msg_put_number (reply, i->utf8_encode);
+#endif
+  msg_put_number (reply, downloaded);
+  msg_put_number (reply, numurls - numurls_before);
+  msg_put_number (reply, total_downloaded_bytes - bytes_before);
+  msg_put_double (reply, total_download_time - time_before);
+
+  if (url_parsed)
+    url_free (url_parsed);
+  xfree (log_text);
+  xfree (file);
+  xfree (redirected);
+  xfree (url);
+  xfree (referer);
+  iri_free (i);
+}
+
+/* Take the results of a download done by a worker from REPLY, as if
+   retrieve_url had been called with URL, FILE, NEWLOC, DT and I:
+   store them in the same places and register the download the same
+   way.
+
+   If ALREADY is non-NULL, URL has meanwhile been registered as
+   downloaded to that file, by an earlier download that was redirected
+   to it.  retrieve_tree would not have downloaded it again, so the
+   results are not registered, and the copy the worker saved under
+   another name is removed.  */
+
+static uerr_t
+parallel_result (struct wmsg *reply, const char *url, char **file,
+                 char **newloc, int *dt, struct iri *i, const char *already)
+{
+  uerr_t status = msg_get_number (reply);
+  char *final_url;
+  downloaded_file_t downloaded;
+
+  *dt = msg_get_number (reply);
+  *file = msg_get_string (reply);
+  *newloc = msg_get_string (reply);
+  final_url = msg_get_string (reply);
+#ifdef ENABLE_IRI
+  xfree (i->uri_encoding);
+  xfree (i->content_encoding);
+  i->uri_encoding = msg_get_string (reply);
+  i->content_encoding = msg_get_string (reply);
+  i->utf8_encode = msg_get_number (reply);
+#else
+  (void) i;
+#endif
+  downloaded = msg_get_number (reply);
+  numurls += msg_get_number (reply);
+  total_downloaded_bytes += msg_get_number (reply);
+  total_download_time += msg_get_double (reply);
+
+  if (already)
+    {
+      DEBUGP (("\"%s\" was downloaded again by a worker.\n", url));
+      if (*file && 0 != strcmp (*file, already) && (*dt & RETROKF)
+          && !opt.noclobber && !opt.timestamping && !opt.always_rest)
+        {
+          logprintf (LOG_VERBOSE, _("Removing %s.\n"), quote (*file));
+          if (unlink (*file))
+            logprintf (LOG_NOTQUIET, "unlink: %s\n", strerror (errno));
+        }
+      xfree (final_url);
+      return status;
+    }
+
+  /* This mirrors the registration at the end of retrieve_url. */
+  if (*file && final_url && (*dt & RETROKF || opt.content_on_error))
+    {
+      register_download (final_url, *file);
+
+      if (!opt.spider && *newloc && 0 != strcmp (url, final_url))
+        register_redirection (url, final_url);
+
+      if (*dt & TEXTHTML)
+        register_html (*file);
+
+      if (*dt & TEXTCSS)
+        register_css (*file);
+    }
+  if (*file && downloaded != FILE_NOT_ALREADY_DOWNLOADED)
+    downloaded_file (downloaded, *file);
+
+  xfree (final_url);
+  return status;
+}
+
+static struct download_slots *
+slots_new (int count)
+{
+  struct download_slots *slots;
+  struct worker_pool *pool = worker_pool_new (count, parallel_retrieve);
+
+  if (!pool)
+    return NULL;
+  slots = xnew0 (struct download_slots);
+  slots->pool = pool;
+  return slots;
+}
+
+static struct pending *
+slots_find (struct download_slots *slots, int job)
+{
+  struct pending *p;
+  for (p = slots->head; p; p = p->next)
+    if (p->job == job)
+      return p;
+  return NULL;
+}
+
+/* Store the results of finished jobs in their pending entries.  If
+   BLOCK is true, wait for at least one.  Returns false if nothing was
+   collected.  */
+
+static bool
+slots_collect (struct download_slots *slots, bool block)
+{
+  struct wmsg reply;
+  int job;
+  bool collected = false;
+
+  msg_init (&reply);
+  while ((job = worker_pool_collect (slots->pool, block, &reply)) >= 0)
+    {
+      struct pending *p = slots_find (slots, job);
+      block = false;
+      collected = true;
+      if (!p)
+        continue;
+      if (!reply.size)
+        {
+          /* The worker died; download the URL here. */
+          p->job = -1;
+          continue;
+        }
+      p->reply = reply;
+      p->done = true;
+      msg_init (&reply);
+    }
+  msg_free (&reply);
+  return collected;
+}
+
+/* Move URLs from the head of QUEUE to SLOTS and give them to idle
+   workers.  */
+
+static void
+slots_fill (struct download_slots *slots, struct url_queue *queue)
+{
+  /* Don't look too far ahead: URLs handled by the main process (see
+     below) would otherwise pile up while the workers are busy.  */
+  int max_pending = 2 * worker_pool_size (slots->pool);
+
+  slots_collect (slots, false);
+
+  while (url_queue_front (queue) && slots->count < max_pending)
+    {
+      struct pending *p;
+      /* URLs that were already downloaded are not downloaded again
+         (see retrieve_tree), so there's no point in sending them to a
+         worker.  */
+      bool local =
+        downloaded_url_file (intern_lookup (queue->head->url)) != 0;
+
+      if (!local && worker_pool_busy (slots->pool)
+                    >= worker_pool_size (slots->pool))
+        break;
+
+      p = xnew0 (struct pending);
+      url_dequeue (queue, &p->iri, &p->url, &p->referer, &p->depth,
+                   &p->html_allowed, &p->css_allowed);
+      p->job = -1;
+
+      if (!local)
+        {
+          struct wmsg job;
+          msg_init (&job);
+          msg_put_string (&job, p->url);
+          msg_put_string (&job, p->referer);
+#ifdef ENABLE_IRI
+          msg_put_string (&job, p->iri->uri_encoding);
+          msg_put_string (&job, p->iri->content_encoding);
+          msg_put_number (&job, p->iri->utf8_encode);
+#endif
+          p->job = worker_pool_submit (slots->pool, &job);
+          msg_free (&job);
+        }
+
+      if (slots->tail)
+        slots->tail->next = p;
+      else
+        slots->head = p;
+      slots->tail = p;
+      ++slots->count;
+    }
+}
+
+/* Like url_dequeue, but take the next URL from SLOTS, after its
+   download is finished.  If it was downloaded by a worker, its output
+   is printed and the results are stored to REPLY, for
+   parallel_result.  Otherwise REPLY is left empty and the caller is
+   to download the URL itself.  */
+
+static bool
+slots_next (struct download_slots *slots, struct url_queue *queue,
+            struct iri **i, char **url, char **referer, int *depth,
+            bool *html_allowed, bool *css_allowed, struct wmsg *reply)
+{
+  struct pending *p;
+
+  slots_fill (slots, queue);
+
+  p = slots->head;
+  if (!p)
+    return false;
+
+  while (p->job >= 0 && !p->done)
+    {
+      if (!slots_collect (slots, true))
+        p->job = -1;
+      slots_fill (slots, queue);
+    }
+
+  slots->head = p->next;
+  if (!slots->head)
+    slots->tail = NULL;
+  --slots->count;
+
+  *i = p->iri;
+  *url = p->url;
+  *referer = p->referer;
+  *depth = p->depth;
+  *html_allowed = p->html_allowed;
+  *css_allowed = p->css_allowed;
+  *reply = p->reply;
+
+  if (p->done)
+    {
+      char *log_text = msg_get_string (reply);
+      if (log_text)
+        logputs (LOG_ALWAYS, log_text);
+      xfree (log_text);
+    }
+  xfree (p);
+
+  /* Keep the workers busy while the caller processes this URL. */
+  slots_fill (slots, queue);
+  return true;
+}
+
+/* Terminate the workers and free SLOTS.  The downloads that have
+   already been started are allowed to finish and registered, so that
+   the files they leave behind are known to the link conversion.  */
+
+static void
+slots_delete (struct download_slots *slots)
+{
+  while (slots->head)
+    {
+      struct pending *p = slots->head;
+
+      while (p->job >= 0 && !p->done)
+        if (!slots_collect (slots, true))
+          p->job = -1;
+      if (p->done)
+        {
+          char *log_text = msg_get_string (&p->reply);
+          char *file, *newloc;
+          int dt;
+          intern_id file_id = downloaded_url_file (intern_lookup (p->url));
+          char *already = file_id ? intern_strdup (file_id) : NULL;
+
+          if (log_text)
+            logputs (LOG_ALWAYS, log_text);
+          xfree (log_text);
+          parallel_result (&p->reply, p->url, &file, &newloc, &dt, p->iri,
+                           already);
+          xfree (already);
+          xfree (file);
+          xfree (newloc);
+          msg_free (&p->reply);
+        }
+
+      slots->head = p->next;
+      iri_free (p->iri);
+      xfree (p->url);
+      xfree (p->referer);
+      xfree (p);
+    }
+  worker_pool_delete (slots->pool);
+  xfree (slots);
+}
+
+/* Announce the URLs at the head of QUEUE to the HTTP code, which may
+   pipeline the requests for them.  URLS and REFERERS must have room
+   for opt.http_pipeline entries, which are filled with allocated
+   strings that the caller frees with pipeline_hint_free once the
+   download is done.  URLs that have already been downloaded are left
+   out, since they won't be requested.  The URLs in spill files are not
+   worth reading early for this.  */
+
+static void
+pipeline_hint (struct url_queue *queue, char **urls, char **referers)
+{
+  const struct queue_element *qel;
+  const struct queue_element *parts[2];
+  int count = 0, k;
+
+  parts[0] = url_queue_front (queue);
+  parts[1] = queue->spill_head ? NULL : queue->back;
+
+  for (k = 0; k < 2; k++)
+    for (qel = parts[k]; qel && count < opt.http_pipeline; qel = qel->next)
+      {
+        if (downloaded_url_file (intern_lookup (qel->url)))
+          continue;
+        urls[count] = xstrdup (qel->url);
+        referers[count] = qel->referer ? xstrdup (qel->referer) : NULL;
+        ++count;
+      }
+  http_pipeline_hint ((const char **) urls, (const char **) referers, count);
+}
+
+/* Withdraw the URLs announced by pipeline_hint and free them. */
+
+static void
+pipeline_hint_free (char **urls, char **referers)
+{
+  int k;
+
+  http_pipeline_hint (NULL, NULL, 0);
+  for (k = 0; k < opt.http_pipeline; k++)
+    {
+      xfree (urls[k]);
+      xfree (referers[k]);
+    }
+}
+
+/* Checkpoints of recursive retrieval, for --crawl-state.  Every
+   opt.crawl_state_interval seconds, and when retrieve_tree returns, the
+   state of the crawl is written to opt.crawl_state: the start URLs
+   whose crawl is finished, the download registry (see convert.c), and
+   the blacklist and queue of the crawl under way.  If Wget is killed,
+   running it again with the same file continues from the last
+   checkpoint.  The file is written under a temporary name and renamed
+   over the old one once it is safely on disk, so a crash while
+   writing it leaves the previous checkpoint intact.  It is removed
+   when all the crawls are done.
+
+   Each checkpoint writes the whole state, which grows with the crawl.
+   The checkpoints are therefore spaced out to at least ten times the
+   time the last one took.
+
+   The file consists of numbers and strings (see fput_number and
+   fput_string), in this order:
+
+     CRAWL_STATE_MAGIC
+     the start URL of the crawl under way, or NULL
+     the number of finished start URLs, followed by them
+     the download registry
+     the number of blacklisted URLs, followed by them
+     the number of queued URLs, followed by them, in the format of the
+     spill files  */
+
+#define CRAWL_STATE_MAGIC "GNU Wget crawl state 1"
+
+/* Whether opt.crawl_state has been read. */
+static bool crawl_state_read;
+
+/* The start URLs whose crawl is finished. */
+static struct hash_table *crawls_finished;
+
+/* The state file, positioned at the blacklist, and the start URL of
+   the crawl that blacklist and queue belong to.  They are kept until
+   retrieve_tree is called with that URL.  */
+static FILE *crawl_state_fp;
+static char *crawl_state_url;
+
+/* Set when a crawl is cut short, so that its state is kept. */
+static bool crawl_incomplete;
+
+/* Read the finished start URLs and the download registry from
+   opt.crawl_state.  */
+
+static void
+crawl_state_open (void)
+{
+  FILE *fp;
+  char *magic = NULL;
+  unsigned long count;
+  bool ok;
+
+  crawl_state_read = true;
+  fp = fopen (opt.crawl_state, "rb");
+  if (!fp)
+    {
+      if (errno != ENOENT)
+        logprintf (LOG_NOTQUIET, _("Cannot open %s: %s\n"),
+                   quote (opt.crawl_state), strerror (errno));
+      return;
+    }
+
+  ok = fget_string (fp, &magic) && magic
+    && 0 == strcmp (magic, CRAWL_STATE_MAGIC)
+    && fget_string (fp, &crawl_state_url)
+    && fget_number (fp, &count);
+  while (ok && count--)
+    {
+      char *url;
+
+      ok = fget_string (fp, &url) && url;
+      if (ok)
+        {
+          if (!crawls_finished)
+            crawls_finished = make_string_hash_table (0);
+          string_set_add (crawls_finished, url);
+        }
+      xfree (url);
+    }
+  ok = ok && load_download_registry (fp);
+  xfree (magic);
+
+  if (!ok)
+    {
+      logprintf (LOG_NOTQUIET, _("%s is not a valid crawl state file.\n"),
+                 quote (opt.crawl_state));
+      xfree (crawl_state_url);
+    }
+  if (crawl_state_url)
+    crawl_state_fp = fp;
+  else
+    fclose (fp);
+}
+
+/* Restore the blacklist and queue of the crawl of START_URL from the
+   state file, if they are there.  Returns false if they aren't, or
+   can't be read; QUEUE and BLACKLIST are then left empty.  */
+
+static bool
+crawl_state_restore (const char *start_url, struct url_queue *queue,
+                     struct blacklist *blacklist)
+{
+  FILE *fp = crawl_state_fp;
+  unsigned long count;
+  bool ok;
+
+  if (!fp || 0 != strcmp (crawl_state_url, start_url))
+    return false;
+  crawl_state_fp = NULL;
+  xfree (crawl_state_url);
+
+  ok = fget_number (fp, &count);
+  while (ok && count--)
+    {
+      char *url;
+
+      ok = fget_string (fp, &url) && url;
+      if (ok)
+        blacklist_insert (blacklist, url, hash_string (url));
+      xfree (url);
+    }
+  ok = ok && fget_number (fp, &count);
+  while (ok && count--)
+    {
+      struct queue_element *qel = spill_get_element (fp);
+
+      ok = qel != NULL;
+      if (ok)
+        url_queue_append (queue, qel);
+    }
+  fclose (fp);
+
+  if (!ok)
+    {
+      logprintf (LOG_NOTQUIET, _("Cannot read the crawl state from %s;"
+                                 " starting over.\n"),
+                 quote (opt.crawl_state));
+      url_queue_clear (queue);
+      blacklist_free (blacklist);
+      return false;
+    }
+  logprintf (LOG_VERBOSE, _("Continuing the crawl of %s with %d queued URLs.\n"),
+             quote (start_url), queue->count);
+  return true;
+}
+
+/* Write the URLs of QUEUE, preceded by those dequeued to SLOTS but not
+   yet processed, to FP.  Returns false if a spill file can't be
+   read.  */
+
+static bool
+crawl_state_put_queue (FILE *fp, struct url_queue *queue,
+                       struct download_slots *slots)
+{
+  const struct queue_element *qel;
+  const struct pending *p;
+  struct spill_file *sf;
+
+  fput_number (fp, queue->count + (slots ? slots->count : 0));
+  for (p = slots ? slots->head : NULL; p; p = p->next)
+    spill_put_record (fp, p->url, p->referer, p->depth, p->html_allowed,
+                      p->css_allowed, p->iri);
+  for (qel = queue->head; qel; qel = qel->next)
+    spill_put_element (fp, qel);
+
+  for (sf = queue->spill_head; sf; sf = sf->next)
+    {
+      /* Copy the records that haven't been read back yet, then return
+         to where the file is read or appended to.  */
+      long pos = sf->reading ? ftell (sf->fp) : 0;
+      bool ok = pos >= 0 && fseek (sf->fp, pos, SEEK_SET) == 0;
+      int k;
+
+      for (k = 0; ok && k < sf->count; k++)
+        {
+          struct queue_element *e = spill_get_element (sf->fp);
+
+          ok = e != NULL;
+          if (ok)
+            {
+              spill_put_element (fp, e);
+              free_queue_elements (e);
+            }
+        }
+      if (fseek (sf->fp, sf->reading ? pos : 0, sf->reading ? SEEK_SET
+                 : SEEK_END) != 0)
+        ok = false;
+      if (!ok)
+        return false;
+    }
+
+  for (qel = queue->back; qel; qel = qel->next)
+    spill_put_element (fp, qel);
+  return true;
+}
+
+/* Write a checkpoint to opt.crawl_state.  START_URL is the start URL of
+   the crawl under way, or NULL if there is none.  */
+
+static void
+crawl_state_save (const char *start_url, struct url_queue *queue,
+                  struct download_slots *slots,
+                  const struct blacklist *blacklist)
+{
+  char *tmp = aprintf ("%s.tmp", opt.crawl_state);
+  FILE *fp = fopen (tmp, "wb");
+  hash_table_iterator iter;
+  bool ok = true;
+
+  if (!fp)
+    {
+      logprintf (LOG_NOTQUIET, _("Cannot open %s: %s\n"),
+                 quote (tmp), strerror (errno));
+      xfree (tmp);
+      return;
+    }
+
+  fput_string (fp, CRAWL_STATE_MAGIC);
+  fput_string (fp, start_url);
+  fput_number (fp, crawls_finished ? hash_table_count (crawls_finished) : 0);
+  if (crawls_finished)
+    for (hash_table_iterate (crawls_finished, &iter);
+         hash_table_iter_next (&iter);
+         )
+      fput_string (fp, iter.key);
+  save_download_registry (fp);
+
+  if (start_url)
+    {
+      intern_id id;
+
+      fput_number (fp, blacklist->count);
+      for (id = 1; id < blacklist->size; id++)
+        if (blacklist->bits[id / 8] & (1 << (id % 8)))
+          {
+            char *url = intern_strdup (id);
+            fput_string (fp, url);
+            xfree (url);
+          }
+      ok = crawl_state_put_queue (fp, queue, slots);
+    }
+  else
+    {
+      fput_number (fp, 0);
+      fput_number (fp, 0);
+    }
+
+  /* The data must reach the disk before the rename does, or a crash
+     could leave an empty checkpoint in place of the old one.  */
+  if (fflush (fp) != 0 || ferror (fp) || fsync (fileno (fp)) != 0)
+    ok = false;
+  if (fclose (fp) != 0)
+    ok = false;
+  if (ok && rename (tmp, opt.crawl_state) != 0)
+    ok = false;
+  if (!ok)
+    {
+      logprintf (LOG_NOTQUIET, _("Cannot write the crawl state to %s: %s\n"),
+                 quote (opt.crawl_state), strerror (errno));
+      unlink (tmp);
+    }
+  else
+    DEBUGP (("Saved the crawl state to %s.\n", opt.crawl_state));
+  xfree (tmp);
+}
+
+/* Called when all the URLs have been retrieved.  Unless a crawl was cut
+   short, the state file has served its purpose and is removed.  */
+
+void
+crawl_state_finish (void)
+{
+  if (crawl_state_fp)
+    {
+      fclose (crawl_state_fp);
+      crawl_state_fp = NULL;
+    }
+  xfree (crawl_state_url);
+  if (crawls_finished)
+    {
+      string_set_free (crawls_finished);
+      crawls_finished = NULL;
+    }
+
+  if (crawl_state_read && !crawl_incomplete)
+    {
+      if (unlink (opt.crawl_state) != 0 && errno != ENOENT)
+        logprintf (LOG_NOTQUIET, "unlink: %s\n", strerror (errno));
+    }
 }
 
 typedef enum
@@ -188,10 +1370,12 @@ typedef enum
   WG_RR_SPANNEDHOST, WG_RR_ROBOTS
 } reject_reason;
 
+static void prefetch_hosts (const struct urlpos *, const struct url *);
 static reject_reason download_child (const struct urlpos *, struct url *, int,
-                              struct url *, struct hash_table *, struct iri *);
+                              struct url *, struct blacklist *,
+                              const struct blacklist_key *, struct iri *);
 static reject_reason descend_redirect (const char *, struct url *, int,
-                              struct url *, struct hash_table *, struct iri *);
+                              struct url *, struct blacklist *, struct iri *);
 static void write_reject_log_header (FILE *);
 static void write_reject_log_reason (FILE *, reject_reason,
                               const struct url *, const struct url *);
@@ -227,12 +1411,39 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
 
   /* The URLs we do not wish to enqueue, because they are already in
      the queue, but haven't been downloaded yet.  */
-  struct hash_table *blacklist;
+  struct blacklist blacklist;
+
+  /* The worker processes doing the downloads with --parallel. */
+  struct download_slots *slots = NULL;
+
+  /* The upcoming URLs announced for --http-pipeline. */
+  char **next_urls = NULL, **next_referers = NULL;
 
   struct iri *i = iri_new ();
 
   FILE *rejectedlog = NULL; /* Don't write a rejected log. */
 
+  /* When the state for --crawl-state was last saved, and how long to
+     wait before saving it again.  */
+  struct ptimer *state_timer = NULL;
+  double state_saved = 0, state_wait = opt.crawl_state_interval;
+  bool finished = false;
+
+  if (opt.crawl_state)
+    {
+      if (!crawl_state_read)
+        crawl_state_open ();
+      if (crawls_finished
+          && string_set_contains (crawls_finished, start_url_parsed->url))
+        {
+          logprintf (LOG_VERBOSE, _("The crawl of %s is already finished.\n"),
+                     quote (start_url_parsed->url));
+          iri_free (i);
+          return RETROK;
+        }
+      state_timer = ptimer_new ();
+    }
+
   /* Duplicate pi struct if not NULL */
   if (pi)
     {
@@ -248,13 +1459,26 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
 #endif
 
   queue = url_queue_new ();
-  blacklist = make_string_hash_table (0);
+  xzero (blacklist);
 
-  /* Enqueue the starting URL.  Use start_url_parsed->url rather than
-     just URL so we enqueue the canonical form of the URL.  */
-  url_enqueue (queue, i, xstrdup (start_url_parsed->url), NULL, 0, true,
-               false);
-  blacklist_add (blacklist, start_url_parsed->url);
+  if (opt.crawl_state
+      && crawl_state_restore (start_url_parsed->url, queue, &blacklist))
+    iri_free (i);
+  else
+    {
+      /* Enqueue the starting URL.  Use start_url_parsed->url rather
+         than just URL so we enqueue the canonical form of the URL.  */
+      url_enqueue (queue, i, start_url_parsed->url, NULL, 0, true, false);
+      blacklist_add (&blacklist, start_url_parsed->url);
+    }
+
+  if (opt.parallel > 1)
+    slots = slots_new (opt.parallel);
+  if (opt.http_pipeline > 0 && !slots)
+    {
+      next_urls = xnew0_array (char *, opt.http_pipeline);
+      next_referers = xnew0_array (char *, opt.http_pipeline);
+    }
 
   if (opt.rejected_log)
     {
@@ -268,10 +1492,13 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
     {
       bool descend = false;
       char *url, *referer, *file = NULL;
+      intern_id file_id;
       int depth;
       bool html_allowed, css_allowed;
       bool is_css = false;
       bool dash_p_leaf_HTML = false;
+      bool remove_file;
+      struct wmsg reply;
 
       if (opt.quota && total_downloaded_bytes > opt.quota)
         break;
@@ -280,10 +1507,22 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
 
       /* Get the next URL from the queue... */
 
-      if (!url_dequeue (queue, (struct iri **) &i,
-                        (const char **)&url, (const char **)&referer,
-                        &depth, &html_allowed, &css_allowed))
-        break;
+      msg_init (&reply);
+      if (slots)
+        {
+          if (!slots_next (slots, queue, &i, &url, &referer, &depth,
+                           &html_allowed, &css_allowed, &reply))
+            {
+              finished = true;
+              break;
+            }
+        }
+      else if (!url_dequeue (queue, &i, &url, &referer,
+                             &depth, &html_allowed, &css_allowed))
+        {
+          finished = true;
+          break;
+        }
 
       /* ...and download it.  Note that this download is in most cases
          unconditional, as download_child already makes sure a file
@@ -293,21 +1532,39 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
          and again under URL2, but at a different (possibly smaller)
          depth, we want the URL's children to be taken into account
          the second time.  */
-      if (dl_url_file_map && hash_table_contains (dl_url_file_map, url))
+      if ((file_id = downloaded_url_file (intern_lookup (url))) != 0)
         {
           bool is_css_bool;
+          unsigned long file_hash;
 
-          file = xstrdup (hash_table_get (dl_url_file_map, url));
+          file = intern_strdup (file_id);
+          file_hash = hash_string (file);
 
           DEBUGP (("Already downloaded \"%s\", reusing it from \"%s\".\n",
                    url, file));
 
+          if (reply.size)
+            {
+              /* A worker was given the URL before an earlier download
+                 was found to be redirected to it.  */
+              struct iri *ri = iri_new ();
+              char *rfile, *rnewloc;
+              int rdt;
+
+              parallel_result (&reply, url, &rfile, &rnewloc, &rdt, ri, file);
+              xfree (rfile);
+              xfree (rnewloc);
+              iri_free (ri);
+            }
+
           if ((is_css_bool = (css_allowed
                   && downloaded_css_set
-                  && string_set_contains (downloaded_css_set, file)))
+                  && hash_table_contains_hashed (downloaded_css_set, file,
+                                                 file_hash)))
               || (html_allowed
                 && downloaded_html_set
-                && string_set_contains (downloaded_html_set, file)))
+                && hash_table_contains_hashed (downloaded_html_set, file,
+                                               file_hash)))
             {
               descend = true;
               is_css = is_css_bool;
@@ -329,8 +1586,18 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
           else
             {
 
-              status = retrieve_url (url_parsed, url, &file, &redirected, referer,
-                                     &dt, false, i, true);
+              if (reply.size)
+                status = parallel_result (&reply, url, &file, &redirected,
+                                          &dt, i, NULL);
+              else
+                {
+                  if (next_urls)
+                    pipeline_hint (queue, next_urls, next_referers);
+                  status = retrieve_url (url_parsed, url, &file, &redirected,
+                                         referer, &dt, false, i, true);
+                  if (next_urls)
+                    pipeline_hint_free (next_urls, next_referers);
+                }
 
               if (html_allowed && file && status == RETROK
                   && (dt & RETROKF) && (dt & TEXTHTML))
@@ -358,12 +1625,12 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
                   if (descend)
                     {
                       reject_reason r = descend_redirect (redirected, url_parsed,
-                                        depth, start_url_parsed, blacklist, i);
+                                        depth, start_url_parsed, &blacklist, i);
                       if (r == WG_RR_SUCCESS)
                         {
                           /* Make sure that the old pre-redirect form gets
                              blacklisted. */
-                          blacklist_add (blacklist, url);
+                          blacklist_add (&blacklist, url);
                         }
                       else
                         {
@@ -384,6 +1651,14 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
             }
         }
 
+      if (descend && opt.convert_early && converted_early (file))
+        {
+          /* Its links have been converted and can't be followed
+             again.  */
+          DEBUGP (("Not descending into converted \"%s\".\n", file));
+          descend = false;
+        }
+
       if (opt.spider)
         {
           visited_url (url, referer);
@@ -415,26 +1690,38 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
             }
         }
 
+      /* Files loaded only for their links are removed below. */
+      remove_file = (file
+                     && (opt.delete_after
+                         || opt.spider /* opt.recursive is implicitly true */
+                         || !acceptable (file)));
+
       /* If the downloaded document was HTML or CSS, parse it and enqueue the
          links it contains. */
 
       if (descend)
         {
           bool meta_disallow_follow = false;
-          struct urlpos *children
-            = is_css ? get_urls_css_file (file, url) :
-                       get_urls_html (file, url, &meta_disallow_follow, i);
+          struct arena arena;
+          struct urlpos *children, *links;
+
+          /* The links are allocated from a per-document arena and
+             released at once when they have been looked at; the ones
+             that are enqueued are copied.  */
+          xzero (arena);
+          children = is_css ? get_urls_css_file (file, url, &arena) :
+                              get_urls_html (file, url, &meta_disallow_follow,
+                                             i, &arena);
+          links = children;
 
           if (opt.use_robots && meta_disallow_follow)
-            {
-              free_urlpos (children);
-              children = NULL;
-            }
+            children = NULL;
 
           if (children)
             {
               struct urlpos *child = children;
-              struct url *url_parsed = url_parse (url, NULL, i, true);
+              struct url *url_parsed = url_parse_arena (url, NULL, i, true,
+                                                        &arena);
               struct iri *ci;
               char *referer_url = url;
               bool strip_auth;
@@ -442,7 +1729,10 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
               assert (url_parsed != NULL);
 
               if (!url_parsed)
-                continue;
+                {
+                  arena_free (&arena);
+                  continue;
+                }
 
               strip_auth = (url_parsed && url_parsed->user);
 
@@ -450,8 +1740,12 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
               if (strip_auth)
                 referer_url = url_string (url_parsed, URL_AUTH_HIDE);
 
+              if (opt.spanhost)
+                prefetch_hosts (children, url_parsed);
+
               for (; child; child = child->next)
                 {
+                  struct blacklist_key bk;
                   reject_reason r;
 
                   if (child->ignore_when_downloading)
@@ -466,38 +1760,39 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
                       continue;
                     }
 
+                  blacklist_key_init (&bk, child->url->url);
                   r = download_child (child, url_parsed, depth,
-                                      start_url_parsed, blacklist, i);
+                                      start_url_parsed, &blacklist, &bk, i);
                   if (r == WG_RR_SUCCESS)
                     {
                       ci = iri_new ();
                       set_uri_encoding (ci, i->content_encoding, false);
-                      url_enqueue (queue, ci, xstrdup (child->url->url),
-                                   xstrdup (referer_url), depth + 1,
+                      url_enqueue (queue, ci, child->url->url,
+                                   referer_url, depth + 1,
                                    child->link_expect_html,
                                    child->link_expect_css);
                       /* We blacklist the URL we have enqueued, because we
                          don't want to enqueue (and hence download) the
                          same URL twice.  */
-                      blacklist_add (blacklist, child->url->url);
+                      blacklist_add_key (&blacklist, &bk);
                     }
                   else
                     {
                       write_reject_log_reason (rejectedlog, r, child->url, url_parsed);
                     }
+                  blacklist_key_free (&bk);
                 }
 
               if (strip_auth)
                 xfree (referer_url);
-              url_free (url_parsed);
-              free_urlpos (children);
             }
+
+          if (opt.convert_early && links && !remove_file)
+            convert_links_early (file, links, &arena);
+          arena_free (&arena);
         }
 
-      if (file
-          && (opt.delete_after
-              || opt.spider /* opt.recursive is implicitly true */
-              || !acceptable (file)))
+      if (remove_file)
         {
           /* Either --delete-after was specified, or we loaded this
              (otherwise unneeded because of --spider or rejected by -R)
@@ -522,32 +1817,56 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
       xfree (referer);
       xfree (file);
       iri_free (i);
+      msg_free (&reply);
+
+      if (state_timer && opt.crawl_state_interval > 0
+          && ptimer_measure (state_timer) - state_saved >= state_wait)
+        {
+          double start = ptimer_read (state_timer);
+
+          crawl_state_save (start_url_parsed->url, queue, slots, &blacklist);
+          state_saved = ptimer_measure (state_timer);
+          state_wait = MAX (opt.crawl_state_interval,
+                            10 * (state_saved - start));
+        }
+    }
+
+  if (state_timer)
+    {
+      /* The URLs still being downloaded by the workers are saved as
+         queued and will be downloaded again.  */
+      if (finished)
+        {
+          if (!crawls_finished)
+            crawls_finished = make_string_hash_table (0);
+          string_set_add (crawls_finished, start_url_parsed->url);
+          crawl_state_save (NULL, NULL, NULL, NULL);
+        }
+      else
+        {
+          crawl_incomplete = true;
+          crawl_state_save (start_url_parsed->url, queue, slots, &blacklist);
+        }
+      ptimer_destroy (state_timer);
     }
 
+  if (slots)
+    slots_delete (slots);
+  xfree (next_urls);
+  xfree (next_referers);
+
   if (rejectedlog)
     {
       fclose (rejectedlog);
       rejectedlog = NULL;
     }
 
-  /* If anything is left of the queue due to a premature exit, free it
-     now.  */
-  {
-    char *d1, *d2;
-    int d3;
-    bool d4, d5;
-    struct iri *d6;
-    while (url_dequeue (queue, (struct iri **)&d6,
-                        (const char **)&d1, (const char **)&d2, &d3, &d4, &d5))
-      {
-        iri_free (d6);
-        xfree (d1);
-        xfree (d2);
-      }
-  }
+  /* If anything is left of the queue due to a premature exit, it is
+     freed along with the queue.  */
   url_queue_delete (queue);
 
-  string_set_free (blacklist);
+  blacklist_free (&blacklist);
+  host_prefetch_cancel ();
 
   if (opt.quota && total_downloaded_bytes > opt.quota)
     return QUOTEXC;
@@ -557,6 +1876,32 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
     return RETROK;
 }
 
+/* Start looking up the hosts the links in CHILDREN point to, other
+   than the host of PARENT, before download_child gets to them.  The
+   robots.txt check, and eventually the downloads, will then find the
+   addresses in the DNS cache instead of waiting for each host in
+   turn.  Only the cheap checks of download_child are done here; a
+   few needless lookups are preferable to doing the rest twice.  */
+
+static void
+prefetch_hosts (const struct urlpos *children, const struct url *parent)
+{
+  const struct urlpos *child;
+
+  for (child = children; child; child = child->next)
+    {
+      struct url *u = child->url;
+
+      if (child->ignore_when_downloading
+          || !schemes_are_similar_p (u->scheme, SCHEME_HTTP)
+          || 0 == strcasecmp (u->host, parent->host)
+          || !accept_domain (u)
+          || url_uses_proxy (u))
+        continue;
+      host_prefetch (u->host);
+    }
+}
+
 /* Based on the context provided by retrieve_tree, decide whether a
    URL is to be descended to.  This is only ever called from
    retrieve_tree, but is in a separate function for clarity.
@@ -567,8 +1912,8 @@ retrieve_tree (struct url *start_url_parsed, struct iri *pi)
 
 static reject_reason
 download_child (const struct urlpos *upos, struct url *parent, int depth,
-                  struct url *start_url_parsed, struct hash_table *blacklist,
-                  struct iri *iri)
+                  struct url *start_url_parsed, struct blacklist *blacklist,
+                  const struct blacklist_key *bk, struct iri *iri)
 {
   struct url *u = upos->url;
   const char *url = u->url;
@@ -577,7 +1922,7 @@ download_child (const struct urlpos *upos, struct url *parent, int depth,
 
   DEBUGP (("Deciding whether to enqueue \"%s\".\n", url));
 
-  if (blacklist_contains (blacklist, url))
+  if (blacklist_contains (blacklist, bk))
     {
       if (opt.spider)
         {
@@ -758,7 +2103,7 @@ download_child (const struct urlpos *upos, struct url *parent, int depth,
       if (!res_match_path (specs, u->path))
         {
           DEBUGP (("Not following %s because robots.txt forbids it.\n", url));
-          blacklist_add (blacklist, url);
+          blacklist_add_key (blacklist, bk);
           reason = WG_RR_ROBOTS;
           goto out;
         }
@@ -783,11 +2128,12 @@ download_child (const struct urlpos *upos, struct url *parent, int depth,
 
 static reject_reason
 descend_redirect (const char *redirected, struct url *orig_parsed, int depth,
-                    struct url *start_url_parsed, struct hash_table *blacklist,
+                    struct url *start_url_parsed, struct blacklist *blacklist,
                     struct iri *iri)
 {
   struct url *new_parsed;
   struct urlpos *upos;
+  struct blacklist_key bk;
   reject_reason reason;
 
   assert (orig_parsed != NULL);
@@ -798,20 +2144,22 @@ descend_redirect (const char *redirected, struct url *orig_parsed, int depth,
   upos = xnew0 (struct urlpos);
   upos->url = new_parsed;
 
+  blacklist_key_init (&bk, upos->url->url);
   reason = download_child (upos, orig_parsed, depth,
-                              start_url_parsed, blacklist, iri);
+                              start_url_parsed, blacklist, &bk, iri);
 
   if (reason == WG_RR_SUCCESS)
-    blacklist_add (blacklist, upos->url->url);
+    blacklist_add_key (blacklist, &bk);
   else if (reason == WG_RR_LIST || reason == WG_RR_REGEX)
     {
       DEBUGP (("Ignoring decision for redirects, decided to load it.\n"));
-      blacklist_add (blacklist, upos->url->url);
+      blacklist_add_key (blacklist, &bk);
       reason = WG_RR_SUCCESS;
     }
   else
     DEBUGP (("Redirection \"%s\" failed the test.\n", redirected));
 
+  blacklist_key_free (&bk);
   url_free (new_parsed);
   xfree (upos);
 
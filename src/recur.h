@@ -45,5 +45,6 @@ struct urlpos;
 
 void recursive_cleanup (void);
 uerr_t retrieve_tree (struct url *, struct iri *);
+void crawl_state_finish (void);
 
 #endif /* RECUR_H */
@@ -36,6 +36,12 @@ as that of the covered work.  */
 #include <errno.h>
 #include <string.h>
 #include <assert.h>
+#include <limits.h>
+#include <signal.h>
+#ifdef HAVE_SPLICE
+# include <fcntl.h>
+# include <sys/stat.h>
+#endif
 #ifdef VMS
 # include <unixio.h>            /* For delete(). */
 #endif
@@ -60,6 +66,7 @@ as that of the covered work.  */
 #include "html-url.h"
 #include "iri.h"
 #include "hsts.h"
+#include "warc.h"
 
 /* Total size of downloaded files.  Used to enforce quota.  */
 SUM_SIZE_INT total_downloaded_bytes;
@@ -81,7 +88,7 @@ static struct {
   double sleep_adjust;
 } limit_data;
 
-static void
+void
 limit_bandwidth_reset (void)
 {
   xzero (limit_data);
@@ -107,7 +114,7 @@ zfree (voidpf opaque, voidpf address)
    BYTES is the number of bytes received from the network, and TIMER
    is the timer that started at the beginning of download.  */
 
-static void
+void
 limit_bandwidth (wgint bytes, struct ptimer *timer)
 {
   double delta_t = ptimer_read (timer) - limit_data.chunk_start;
@@ -156,12 +163,165 @@ limit_bandwidth (wgint bytes, struct ptimer *timer)
   limit_data.chunk_start = ptimer_read (timer);
 }
 
+/* Buffering of downloaded data.  Rather than flushing OUT after every
+   read from the network, fd_read_body collects the data in a buffer
+   of opt.write_buffer bytes, which is written to the file when it is
+   full, when opt.flush_interval seconds have passed since the last
+   write, and when the download ends or fails.  Should Wget be killed
+   by SIGINT or SIGTERM meanwhile, the signal handler writes out the
+   buffered data first, so that the file holds everything received so
+   far and can be continued with -c.  */
+
+/* The alignment of the buffer, a page on most systems. */
+#define WBUF_ALIGN 4096
+
+static struct {
+  int fd;                       /* the file being written, or -1 */
+  char *data;                   /* the buffer, aligned to WBUF_ALIGN */
+  char *allocated;              /* the memory allocated for DATA */
+  size_t size;                  /* the capacity of DATA */
+  volatile size_t used;         /* the number of bytes in DATA */
+  double last_write;            /* when DATA was last written out */
+  struct sigaction old_int;     /* the handlers to restore */
+  struct sigaction old_term;
+} wbuf = { .fd = -1 };
+
+/* Write COUNT bytes of BUF to FD, returning false on error.  This is
+   also called from a signal handler, so it must not use stdio.  */
+
+static bool
+write_all (int fd, const char *buf, size_t count)
+{
+  while (count > 0)
+    {
+      ssize_t res = write (fd, buf, count);
+      if (res < 0 && errno == EINTR)
+        continue;
+      if (res <= 0)
+        return false;
+      buf += res;
+      count -= res;
+    }
+  return true;
+}
+
+static void
+wbuf_signal_handler (int sig)
+{
+  if (wbuf.fd >= 0 && wbuf.used)
+    write_all (wbuf.fd, wbuf.data, wbuf.used);
+  signal (sig, SIG_DFL);
+  raise (sig);
+}
+
+/* Write out the buffered data.  The signals that would write it as
+   well are blocked meanwhile.  */
+
+static bool
+wbuf_flush (void)
+{
+  sigset_t set, old;
+  bool ok;
+
+  if (!wbuf.used)
+    return true;
+  sigemptyset (&set);
+  sigaddset (&set, SIGINT);
+  sigaddset (&set, SIGTERM);
+  sigprocmask (SIG_BLOCK, &set, &old);
+  ok = write_all (wbuf.fd, wbuf.data, wbuf.used);
+  wbuf.used = 0;
+  sigprocmask (SIG_SETMASK, &old, NULL);
+  return ok;
+}
+
+/* Add COUNT bytes of BUF to the buffer, writing it out as it fills
+   up.  Return false if writing failed.  */
+
+static bool
+wbuf_write (const char *buf, size_t count)
+{
+  while (count > 0)
+    {
+      size_t n = MIN (count, wbuf.size - wbuf.used);
+
+      memcpy (wbuf.data + wbuf.used, buf, n);
+      wbuf.used += n;
+      buf += n;
+      count -= n;
+      if (wbuf.used == wbuf.size && !wbuf_flush ())
+        return false;
+    }
+  return true;
+}
+
+static void
+wbuf_catch (int sig, struct sigaction *old)
+{
+  struct sigaction sa;
+
+  /* Leave ignored signals ignored. */
+  if (sigaction (sig, NULL, old) != 0 || old->sa_handler == SIG_IGN)
+    return;
+  xzero (sa);
+  sa.sa_handler = wbuf_signal_handler;
+  sigemptyset (&sa.sa_mask);
+  sigaction (sig, &sa, NULL);
+}
+
+/* Start buffering the data written to OUT.  Return false if OUT
+   can't be buffered, in which case it is written to directly.  */
+
+static bool
+wbuf_start (FILE *out)
+{
+  if (fflush (out) != 0)
+    return false;
+
+  if (wbuf.size != (size_t) opt.write_buffer)
+    {
+      xfree (wbuf.allocated);
+      wbuf.size = opt.write_buffer;
+      wbuf.allocated = xmalloc (wbuf.size + WBUF_ALIGN - 1);
+      wbuf.data = (char *) (((uintptr_t) wbuf.allocated + WBUF_ALIGN - 1)
+                            & ~(uintptr_t) (WBUF_ALIGN - 1));
+    }
+  wbuf.used = 0;
+  wbuf.last_write = 0;
+  wbuf.fd = fileno (out);
+
+  wbuf_catch (SIGINT, &wbuf.old_int);
+  wbuf_catch (SIGTERM, &wbuf.old_term);
+  return true;
+}
+
+/* Write out the buffered data and stop buffering.  Return false if
+   writing failed.  */
+
+static bool
+wbuf_end (void)
+{
+  bool ok = wbuf_flush ();
+
+  sigaction (SIGINT, &wbuf.old_int, NULL);
+  sigaction (SIGTERM, &wbuf.old_term, NULL);
+  wbuf.fd = -1;
+  return ok;
+}
+
+/* Whether the data fd_read_body writes is to be parsed for links as
+   it arrives, see links_stream_feed.  */
+static bool scan_links;
+
 /* Write data in BUF to OUT.  However, if *SKIP is non-zero, skip that
    amount of data and decrease SKIP.  Increment *TOTAL by the amount
    of data written.  If OUT2 is not NULL, also write BUF to OUT2.
    In case of error writing to OUT, -2 is returned.  In case of error
    writing to OUT2, -3 is returned.  Return 1 if the whole BUF was
-   skipped.  */
+   skipped.
+
+   While fd_read_body buffers OUT, the data goes to the buffer instead
+   of through stdio.  Otherwise OUT is flushed immediately.  */
 
 static int
 write_data (FILE *out, FILE *out2, const char *buf, int bufsize,
@@ -187,32 +347,28 @@ write_data (FILE *out, FILE *out2, const char *buf, int bufsize,
         }
     }
 
-  if (out)
+  if (out && scan_links)
+    links_stream_feed (buf, bufsize);
+
+  if (out && wbuf.fd >= 0)
+    {
+      if (!wbuf_write (buf, bufsize))
+        return -2;
+    }
+  else if (out)
     fwrite (buf, 1, bufsize, out);
   if (out2)
-    fwrite (buf, 1, bufsize, out2);
+    warc_tempfile_write (out2, buf, bufsize);
 
   if (written)
     *written += bufsize;
 
-  /* Immediately flush the downloaded data.  This should not hinder
-     performance: fast downloads will arrive in large 16K chunks
-     (which stdio would write out immediately anyway), and slow
-     downloads wouldn't be limited by disk speed.  */
-
-  /* 2005-04-20 SMS.
-     Perhaps it shouldn't hinder performance, but it sure does, at least
-     on VMS (more than 2X).  Rather than speculate on what it should or
-     shouldn't do, it might make more sense to test it.  Even better, it
-     might be nice to explain what possible benefit it could offer, as
-     it appears to be a clear invitation to poor performance with no
-     actual justification.  (Also, why 16K?  Anyone test other values?)
-  */
+  /* Without a write buffer (--write-buffer=0), flush the downloaded
+     data immediately, as Wget always used to.  This doubles the run
+     time on VMS, so it is not done there.  */
 #ifndef __VMS
-  if (out)
+  if (out && wbuf.fd < 0)
     fflush (out);
-  if (out2)
-    fflush (out2);
 #endif /* ndef __VMS */
 
   if (out && ferror (out))
@@ -223,10 +379,37 @@ write_data (FILE *out, FILE *out2, const char *buf, int bufsize,
   return 0;
 }
 
+#ifdef HAVE_SPLICE
+/* The amount of data moved by one call to fd_splice.  Since the data
+   is not copied to user space, this can be larger than DLBUF; it is
+   the default capacity of a pipe on Linux.  */
+#define SPLICE_SIZE (64 * 1024)
+
+/* Return true if OUT is a file fd_splice can write to: a regular file
+   not opened for appending, which splice refuses.  */
+
+static bool
+splice_target_p (FILE *out)
+{
+  struct stat st;
+  int flags;
+
+  if (fstat (fileno (out), &st) != 0 || !S_ISREG (st.st_mode))
+    return false;
+  flags = fcntl (fileno (out), F_GETFL);
+  return flags != -1 && !(flags & O_APPEND);
+}
+#endif /* HAVE_SPLICE */
+
 /* Read the contents of file descriptor FD until it the connection
    terminates or a read error occurs.  The data is read in portions of
-   up to 16K and written to OUT as it arrives.  If opt.verbose is set,
-   the progress is shown.
+   8K at first, and written to OUT as it arrives.  If opt.verbose is
+   set, the progress is shown.
+
+   The read buffer grows while the reads keep filling it, up to
+   opt.read_buffer bytes, so that fast connections take fewer reads,
+   and shrinks back when the reads return little or nothing, so that
+   idle and slow connections don't hold on to the memory.
 
    TOREAD is the amount of data expected to arrive, normally only used
    by the progress gauge.
@@ -243,6 +426,13 @@ write_data (FILE *out, FILE *out2, const char *buf, int bufsize,
    response, everything -- including the chunk headers -- is written
    to OUT2.  (OUT will only get the unchunked response.)
 
+   Where splice is available, a body that is neither chunked nor
+   compressed, and that goes to a regular file only, is moved from
+   the socket to OUT by the kernel rather than through DLBUF.
+
+   If FLAGS has rb_scan_links, the data written to OUT is also given
+   to links_stream_feed, to be parsed for links.
+
    The function exits and returns the amount of data read.  In case of
    error while reading data, -1 is returned.  In case of error while
    writing data to OUT, -2 is returned.  In case of error while writing
@@ -257,9 +447,15 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
   int ret = 0;
 #undef max
 #define max(a,b) ((a) > (b) ? (a) : (b))
-  int dlbufsize = max (BUFSIZ, 8 * 1024);
+  const int dlbufmin = max (BUFSIZ, 8 * 1024);
+  int dlbufsize = dlbufmin;
+  int dlbufmax = dlbufmin;
   char *dlbuf = xmalloc (dlbufsize);
 
+  /* How many reads in a row have filled DLBUF, or returned less than
+     a quarter of it.  */
+  int full_reads = 0, short_reads = 0;
+
   struct ptimer *timer = NULL;
   double last_successful_read_tm = 0;
 
@@ -278,6 +474,11 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
   bool chunked = flags & rb_chunked_transfer_encoding;
   wgint skip = 0;
 
+  /* Whether the data is moved with fd_splice, or else collected in
+     the write buffer.  */
+  bool use_splice = false;
+  bool buffered = false;
+
   /* How much data we've read/written.  */
   wgint sum_read = 0;
   wgint sum_written = 0;
@@ -342,10 +543,10 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
   if (opt.limit_rate)
     limit_bandwidth_reset ();
 
-  /* A timer is needed for tracking progress, for throttling, and for
-     tracking elapsed time.  If either of these are requested, start
-     the timer.  */
-  if (progress || opt.limit_rate || elapsed)
+  /* A timer is needed for tracking progress, for throttling, for
+     flushing the write buffer, and for tracking elapsed time.  If
+     either of these are requested, start the timer.  */
+  if (progress || opt.limit_rate || opt.flush_interval || elapsed)
     {
       timer = ptimer_new ();
       last_successful_read_tm = 0;
@@ -358,6 +559,29 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
   if (opt.limit_rate && opt.limit_rate < dlbufsize)
     dlbufsize = opt.limit_rate;
 
+  /* For the same reason, don't grow the buffer beyond the limit. */
+  if (opt.read_buffer > dlbufmax)
+    dlbufmax = MIN (opt.read_buffer, INT_MAX / 2);
+  if (opt.limit_rate && opt.limit_rate < dlbufmax)
+    dlbufmax = MAX (opt.limit_rate, dlbufsize);
+
+#ifdef HAVE_SPLICE
+  /* Bodies written as they arrive to a file, and nowhere else, don't
+     need to pass through DLBUF.  Throttled downloads keep using the
+     small buffer.  OUT's buffer is flushed first, as fd_splice writes
+     to the file underneath.  */
+  if (out && !out2 && !chunked && !skip && !opt.limit_rate
+      && !(flags & (rb_compressed_gzip | rb_scan_links))
+      && splice_target_p (out) && fd_splice_p (fd)
+      && fflush (out) == 0)
+    use_splice = true;
+#endif
+
+  if (out && !use_splice && opt.write_buffer > 0)
+    buffered = wbuf_start (out);
+
+  scan_links = out && (flags & rb_scan_links);
+
   /* Read from FD while there is data to read.  Normally toread==0
      means that it is unknown how much data is to arrive.  However, if
      EXACT is set, then toread==0 means what it says: that no data
@@ -379,7 +603,7 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
                   break;
                 }
               else if (out2 != NULL)
-                fwrite (line, 1, strlen (line), out2);
+                warc_tempfile_write (out2, line, strlen (line));
 
               remaining_chunk_size = strtol (line, &endl, 16);
               xfree (line);
@@ -399,7 +623,7 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
                   else
                     {
                       if (out2 != NULL)
-                        fwrite (line, 1, strlen (line), out2);
+                        warc_tempfile_write (out2, line, strlen (line));
                       xfree (line);
                     }
                   break;
@@ -437,14 +661,31 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
                 }
             }
         }
-      ret = fd_read (fd, dlbuf, rdsize, tmout);
+#ifdef HAVE_SPLICE
+      if (use_splice)
+        {
+          int splice_size = exact ? MIN (toread - sum_read, SPLICE_SIZE)
+                                  : SPLICE_SIZE;
+          ret = fd_splice (fd, fileno (out), splice_size, tmout);
+          if (ret == -2)
+            goto out;
+          if (ret == -3)
+            {
+              DEBUGP (("Cannot splice from socket %d, reading it instead.\n",
+                       fd));
+              use_splice = false;
+            }
+        }
+      if (!use_splice)
+#endif
+        ret = fd_read (fd, dlbuf, rdsize, tmout);
 
       if (progress_interactive && ret < 0 && errno == ETIMEDOUT)
         ret = 0;                /* interactive timeout, handled above */
       else if (ret <= 0)
         break;                  /* EOF or read error */
 
-      if (progress || opt.limit_rate || elapsed)
+      if (timer)
         {
           ptimer_measure (timer);
           if (ret > 0)
@@ -457,6 +698,11 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
 
           sum_read += ret;
 
+#ifdef HAVE_SPLICE
+          if (use_splice)
+            sum_written += ret;
+          else
+#endif
 #ifdef HAVE_LIBZ
           if (gzbuf != NULL)
             {
@@ -537,13 +783,58 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
                   else
                     {
                       if (out2 != NULL)
-                        fwrite (line, 1, strlen (line), out2);
+                        warc_tempfile_write (out2, line, strlen (line));
                       xfree (line);
                     }
                 }
             }
         }
 
+      /* Double the buffer after two reads in a row have filled it,
+         and halve it after four reads in a row have returned less
+         than a quarter of it.  A read that timed out means the
+         connection has stalled; shrink the buffer to the minimum.  */
+      if (!use_splice)
+        {
+          int newsize = dlbufsize;
+
+          if (ret == dlbufsize)
+            {
+              short_reads = 0;
+              if (++full_reads >= 2 && dlbufsize < dlbufmax)
+                newsize = MIN (dlbufsize * 2, dlbufmax);
+            }
+          else if (ret == 0)
+            newsize = MIN (dlbufsize, dlbufmin);
+          else if (ret < dlbufsize / 4)
+            {
+              full_reads = 0;
+              if (++short_reads >= 4 && dlbufsize > dlbufmin)
+                newsize = MAX (dlbufsize / 2, dlbufmin);
+            }
+          else
+            full_reads = short_reads = 0;
+
+          if (newsize != dlbufsize)
+            {
+              DEBUGP (("Resizing the read buffer to %d bytes.\n", newsize));
+              dlbufsize = newsize;
+              dlbuf = xrealloc (dlbuf, dlbufsize);
+              full_reads = short_reads = 0;
+            }
+        }
+
+      if (buffered && opt.flush_interval
+          && ptimer_read (timer) - wbuf.last_write >= opt.flush_interval)
+        {
+          wbuf.last_write = ptimer_read (timer);
+          if (!wbuf_flush ())
+            {
+              ret = -2;
+              goto out;
+            }
+        }
+
       if (opt.limit_rate)
         limit_bandwidth (ret, timer);
 
@@ -559,6 +850,22 @@ fd_read_body (const char *downloaded_filename, int fd, FILE *out, wgint toread,
     ret = -1;
 
  out:
+  /* Write out what is buffered, even if reading failed, so that the
+     download can be continued from there.  */
+  if (buffered && !wbuf_end () && ret >= 0)
+    ret = -2;
+
+  scan_links = false;
+
+  if (use_splice || buffered)
+    {
+      /* Let stdio know where the file has been written to behind its
+         back.  */
+      off_t pos = lseek (fileno (out), 0, SEEK_CUR);
+      if (pos != -1)
+        fseeko (out, pos, SEEK_SET);
+    }
+
   if (progress)
     progress_finish (progress, ptimer_read (timer));
 
@@ -1243,7 +1550,7 @@ retrieve_from_file (const char *file, bool html, int *count)
   else
     input_file = (char *) file;
 
-  url_list = (html ? get_urls_html (input_file, NULL, NULL, iri)
+  url_list = (html ? get_urls_html (input_file, NULL, NULL, iri, NULL)
               : get_urls_file (input_file));
 
   xfree (url_file);
@@ -1371,7 +1678,8 @@ sleep_between_retrievals (int count)
     }
 }
 
-/* Free the linked list of urlpos.  */
+/* Free the linked list of urlpos.  Lists allocated from an arena are
+   released with arena_free instead.  */
 void
 free_urlpos (struct urlpos *l)
 {
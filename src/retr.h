@@ -50,11 +50,18 @@ enum {
   /* Used by HTTP/HTTPS*/
   rb_chunked_transfer_encoding = 4,
 
-  rb_compressed_gzip = 8
+  rb_compressed_gzip = 8,
+
+  /* Parse the body for links as it arrives */
+  rb_scan_links = 16
 };
 
 int fd_read_body (const char *, int, FILE *, wgint, wgint, wgint *, wgint *, double *, int, FILE *);
 
+struct ptimer;
+void limit_bandwidth_reset (void);
+void limit_bandwidth (wgint, struct ptimer *);
+
 typedef const char *(*hunk_terminator_t) (const char *, const char *, int);
 
 char *fd_read_hunk (int, hunk_terminator_t, long, long);
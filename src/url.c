@@ -611,7 +611,7 @@ rewrite_shorthand_url (const char *url)
   return ret;
 }
 
-static void split_path (const char *, char **, char **);
+static void split_path (const char *, char **, char **, struct arena *);
 
 /* Like strpbrk, with the exception that it returns the pointer to the
    terminating zero (end-of-string aka "eos") if no matching character
@@ -680,6 +680,20 @@ static const char *parse_errors[] = {
   N_("Invalid IPv6 numeric address")
 };
 
+/* Move the malloc-ed string S to ARENA.  */
+
+static char *
+arena_take (struct arena *arena, char *s)
+{
+  char *copy;
+
+  if (!arena || !s)
+    return s;
+  copy = arena_strdup (arena, s);
+  xfree (s);
+  return copy;
+}
+
 /* Parse a URL.
 
    Return a new struct url if successful, NULL on error.  In case of
@@ -687,6 +701,17 @@ static const char *parse_errors[] = {
    error code. */
 struct url *
 url_parse (const char *url, int *error, struct iri *iri, bool percent_encode)
+{
+  return url_parse_arena (url, error, iri, percent_encode, NULL);
+}
+
+/* Like url_parse, but allocate the struct url and its strings from
+   ARENA.  The result must not be passed to url_free, url_set_dir or
+   url_set_file; it goes away with the arena.  */
+
+struct url *
+url_parse_arena (const char *url, int *error, struct iri *iri,
+                 bool percent_encode, struct arena *arena)
 {
   struct url *u;
   const char *p;
@@ -891,16 +916,17 @@ url_parse (const char *url, int *error, struct iri *iri, bool percent_encode)
         }
     }
 
-  u = xnew0 (struct url);
+  u = arena_alloc (arena, sizeof *u);
+  xzero (*u);
   u->scheme = scheme;
-  u->host   = strdupdelim (host_b, host_e);
+  u->host   = arena_strdupdelim (arena, host_b, host_e);
   u->port   = port;
-  u->user   = user;
-  u->passwd = passwd;
+  u->user   = arena_take (arena, user);
+  u->passwd = arena_take (arena, passwd);
 
-  u->path = strdupdelim (path_b, path_e);
+  u->path = arena_strdupdelim (arena, path_b, path_e);
   path_modified = path_simplify (scheme, u->path);
-  split_path (u->path, &u->dir, &u->file);
+  split_path (u->path, &u->dir, &u->file, arena);
 
   host_modified = lowercase_str (u->host);
 
@@ -918,7 +944,8 @@ url_parse (const char *url, int *error, struct iri *iri, bool percent_encode)
         {
           if (c_iscntrl(*p))
             {
-              url_free(u);
+              if (!arena)
+                url_free(u);
               error_code = PE_INVALID_HOST_NAME;
               goto error;
             }
@@ -930,26 +957,27 @@ url_parse (const char *url, int *error, struct iri *iri, bool percent_encode)
           char *new = idn_encode (iri, u->host);
           if (new)
             {
-              xfree (u->host);
-              u->host = new;
+              if (!arena)
+                xfree (u->host);
+              u->host = arena_take (arena, new);
               host_modified = true;
             }
         }
     }
 
   if (params_b)
-    u->params = strdupdelim (params_b, params_e);
+    u->params = arena_strdupdelim (arena, params_b, params_e);
   if (query_b)
-    u->query = strdupdelim (query_b, query_e);
+    u->query = arena_strdupdelim (arena, query_b, query_e);
   if (fragment_b)
-    u->fragment = strdupdelim (fragment_b, fragment_e);
+    u->fragment = arena_strdupdelim (arena, fragment_b, fragment_e);
 
   if (opt.enable_iri || path_modified || u->fragment || host_modified || path_b == path_e)
     {
       /* If we suspect that a transformation has rendered what
          url_string might return different from URL_ENCODED, rebuild
          u->url using url_string.  */
-      u->url = url_string (u, URL_AUTH_SHOW);
+      u->url = arena_take (arena, url_string (u, URL_AUTH_SHOW));
 
       if (url_encoded != url)
         xfree (url_encoded);
@@ -957,9 +985,9 @@ url_parse (const char *url, int *error, struct iri *iri, bool percent_encode)
   else
     {
       if (url_encoded == url)
-        u->url = xstrdup (url);
+        u->url = arena_strdup (arena, url);
       else
-        u->url = (char *) url_encoded;
+        u->url = arena_take (arena, (char *) url_encoded);
     }
 
   return u;
@@ -1015,21 +1043,21 @@ url_error (const char *url, int error_code)
    "foo"                ""            "foo"
    "foo/bar/baz%2fqux"  "foo/bar"     "baz/qux" (!)
 
-   DIR and FILE are freshly allocated.  */
+   DIR and FILE are freshly allocated, from ARENA if it is not NULL.  */
 
 static void
-split_path (const char *path, char **dir, char **file)
+split_path (const char *path, char **dir, char **file, struct arena *arena)
 {
   char *last_slash = strrchr (path, '/');
   if (!last_slash)
     {
-      *dir = xstrdup ("");
-      *file = xstrdup (path);
+      *dir = arena_strdup (arena, "");
+      *file = arena_strdup (arena, path);
     }
   else
     {
-      *dir = strdupdelim (path, last_slash);
-      *file = xstrdup (last_slash + 1);
+      *dir = arena_strdupdelim (arena, path, last_slash);
+      *file = arena_strdup (arena, last_slash + 1);
     }
   url_unescape (*dir);
   url_unescape (*file);
@@ -94,12 +94,16 @@ struct url
 
 /* Function declarations */
 
+struct arena;                   /* forward decl */
+
 char *url_escape (const char *);
 char *url_escape_unsafe_and_reserved (const char *);
 void url_unescape (char *);
 void url_unescape_except_reserved (char *);
 
 struct url *url_parse (const char *, int *, struct iri *iri, bool percent_encode);
+struct url *url_parse_arena (const char *, int *, struct iri *iri,
+                             bool percent_encode, struct arena *);
 char *url_error (const char *, int);
 char *url_full_path (const struct url *);
 void url_set_dir (struct url *, const char *);
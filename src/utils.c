@@ -251,6 +251,105 @@ strdupdelim (const char *beg, const char *end)
   return xstrdup("");
 }
 
+/* Arenas.
+
+   An arena hands out memory for objects that are all released at the
+   same time, such as the links found in one document.  Allocating
+   from an arena is merely bumping a pointer in the current block, and
+   arena_free releases everything with one free() per block.  Memory
+   obtained from an arena must not be passed to free().
+
+   The functions below accept a NULL arena, in which case they fall
+   back to malloc, so that code can serve both kinds of callers.  */
+
+#define ARENA_BLOCK_SIZE 16384
+
+struct arena_block {
+  struct arena_block *prev;     /* the previously filled block */
+  size_t size;                  /* usable size of the block */
+  size_t used;                  /* bytes handed out so far */
+};
+
+/* The alignment of the objects handed out, which must be enough for
+   any type stored in an arena. */
+#define ARENA_ALIGN(n) (((n) + sizeof (double) - 1) & ~(sizeof (double) - 1))
+
+/* Allocate SIZE bytes from ARENA, or from the heap if ARENA is NULL.
+   The memory is not cleared.  */
+
+void *
+arena_alloc (struct arena *arena, size_t size)
+{
+  struct arena_block *b;
+
+  if (!arena)
+    return xmalloc (size);
+
+  size = ARENA_ALIGN (size);
+  b = arena->block;
+  if (!b || b->size - b->used < size)
+    {
+      /* Start a new block.  Objects larger than a quarter of the
+         default block get a block of their own. */
+      size_t block_size = (size > ARENA_BLOCK_SIZE / 4
+                           ? size : ARENA_BLOCK_SIZE);
+      b = xmalloc (ARENA_ALIGN (sizeof *b) + block_size);
+      b->size = block_size;
+      b->used = 0;
+      if (arena->block && block_size == size)
+        {
+          /* Keep using the current block for small objects. */
+          b->prev = arena->block->prev;
+          arena->block->prev = b;
+        }
+      else
+        {
+          b->prev = arena->block;
+          arena->block = b;
+        }
+    }
+  b->used += size;
+  return (char *) b + ARENA_ALIGN (sizeof *b) + b->used - size;
+}
+
+/* Like strdupdelim, but allocate the copy from ARENA. */
+
+char *
+arena_strdupdelim (struct arena *arena, const char *beg, const char *end)
+{
+  size_t len = beg && beg <= end ? end - beg : 0;
+  char *res = arena_alloc (arena, len + 1);
+  if (len)
+    memcpy (res, beg, len);
+  res[len] = '\0';
+  return res;
+}
+
+/* Like xstrdup, but allocate the copy from ARENA. */
+
+char *
+arena_strdup (struct arena *arena, const char *s)
+{
+  return arena_strdupdelim (arena, s, s + strlen (s));
+}
+
+/* Release all the memory allocated from ARENA.  ARENA can be used
+   again afterwards.  */
+
+void
+arena_free (struct arena *arena)
+{
+  struct arena_block *b = arena->block;
+
+  while (b)
+    {
+      struct arena_block *prev = b->prev;
+      xfree (b);
+      b = prev;
+    }
+  arena->block = NULL;
+}
+
 /* Parse a string containing comma-separated elements, and return a
    vector of char pointers with the elements.  Spaces following the
    commas are ignored.  */
@@ -959,6 +1058,80 @@ open_stat(const char *fname, int flags, mode_t mode, file_stats_t *fstats)
   return fd;
 }
 
+/* Functions for storing numbers and strings in binary files.
+   Numbers are stored in base 128, least significant digit first, with
+   the high bit set on all but the last byte.  Strings are stored as
+   their length plus one followed by their contents, and NULL as 0.
+   The fget_* functions return false if the file ends or is
+   malformed.  */
+
+void
+fput_number (FILE *fp, unsigned long number)
+{
+  while (number >= 0x80)
+    {
+      putc ((number & 0x7f) | 0x80, fp);
+      number >>= 7;
+    }
+  putc (number, fp);
+}
+
+void
+fput_string (FILE *fp, const char *s)
+{
+  size_t len;
+
+  if (!s)
+    {
+      fput_number (fp, 0);
+      return;
+    }
+  len = strlen (s);
+  fput_number (fp, len + 1);
+  fwrite (s, 1, len, fp);
+}
+
+bool
+fget_number (FILE *fp, unsigned long *number)
+{
+  int c, shift = 0;
+
+  *number = 0;
+  do
+    {
+      c = getc (fp);
+      if (c == EOF || shift >= (int) sizeof (*number) * 8)
+        return false;
+      *number |= (unsigned long) (c & 0x7f) << shift;
+      shift += 7;
+    }
+  while (c & 0x80);
+  return true;
+}
+
+bool
+fget_string (FILE *fp, char **s)
+{
+  unsigned long len;
+
+  *s = NULL;
+  if (!fget_number (fp, &len))
+    return false;
+  if (len-- == 0)
+    return true;
+  /* Don't let a corrupt file make us allocate gigabytes. */
+  if (len > 64 * 1024 * 1024)
+    return false;
+  *s = xmalloc (len + 1);
+  if (fread (*s, 1, len, fp) != len)
+    {
+      xfree (*s);
+      return false;
+    }
+  (*s)[len] = '\0';
+  return true;
+}
+
 /* Create DIRECTORY.  If some of the pathname components of DIRECTORY
    are missing, create them first.  In case any mkdir() call fails,
    return its error status.  Returns 0 on successful completion.
@@ -1497,17 +1670,19 @@ vec_append (char **vec, const char *str)
 void
 string_set_add (struct hash_table *ht, const char *s)
 {
+  unsigned long hash = hash_string (s);
+
   /* First check whether the set element already exists.  If it does,
      do nothing so that we don't have to free() the old element and
      then strdup() a new one.  */
-  if (hash_table_contains (ht, s))
+  if (hash_table_contains_hashed (ht, s, hash))
     return;
 
   /* We use "1" as value.  It provides us a useful and clear arbitrary
      value, and it consumes no memory -- the pointers to the same
      string "1" will be shared by all the key-value pairs in all `set'
      hash tables.  */
-  hash_table_put (ht, xstrdup (s), "1");
+  hash_table_put_hashed (ht, xstrdup (s), "1", hash);
 }
 
 /* Synonym for hash_table_contains... */
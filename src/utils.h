@@ -69,6 +69,17 @@ char *datetime_str (time_t);
 char *xstrdup_lower (const char *);
 
 char *strdupdelim (const char *, const char *);
+
+/* Initialize with xzero before use. */
+struct arena {
+  struct arena_block *block;    /* the block being filled */
+};
+
+void *arena_alloc (struct arena *, size_t);
+char *arena_strdup (struct arena *, const char *);
+char *arena_strdupdelim (struct arena *, const char *, const char *);
+void arena_free (struct arena *);
+
 char **sepstring (const char *);
 bool subdir_p (const char *, const char *);
 bool fork_to_background (void);
@@ -94,6 +105,10 @@ FILE *unique_create (const char *, bool, char **);
 FILE *fopen_excl (const char *, int);
 FILE *fopen_stat (const char *, const char *, file_stats_t *);
 int   open_stat  (const char *, int, mode_t, file_stats_t *);
+void fput_number (FILE *, unsigned long);
+void fput_string (FILE *, const char *);
+bool fget_number (FILE *, unsigned long *);
+bool fget_string (FILE *, char **);
 char *file_merge (const char *, const char *);
 
 int fnmatch_nocase (const char *, const char *, int);
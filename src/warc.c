@@ -47,6 +47,13 @@ as that of the covered work.  */
 #include <zlib.h>
 #endif
 
+/* Compressing records in the background needs threads. */
+#if defined HAVE_LIBZ && defined USE_POSIX_THREADS
+# define ENABLE_WARC_THREADS
+# include <pthread.h>
+# include <signal.h>
+#endif
+
 #ifdef HAVE_LIBUUID
 #include <uuid/uuid.h>
 #elif HAVE_UUID_CREATE
@@ -96,6 +103,37 @@ static off_t warc_current_gzfile_uncompressed_size;
 /* This is true until a warc_write_* method fails. */
 static bool warc_write_ok;
 
+/* The SHA-1 digests of the temporary file last opened by
+   warc_tempfile, computed as warc_tempfile_write adds to it.  When
+   its record is written, the file doesn't have to be read once more
+   for them.  */
+static struct
+{
+  FILE *file;                   /* the file, or NULL */
+  off_t size;                   /* the number of bytes digested */
+  off_t payload_offset;         /* where the payload starts, or -1 */
+  struct sha1_ctx block;        /* the digest of all the bytes */
+  struct sha1_ctx payload;      /* the digest of the payload */
+} warc_tmp_digest;
+
+/* The offset in the WARC file of the record being written, unless it
+   is compressed in the background.  */
+static off_t warc_current_record_offset;
+
+/* The CDX line of the record being written, up to the offset, and the
+   record id that ends it, or NULL.  warc_write_end_record writes the
+   line once the offset of the record is known.  */
+static char *warc_record_cdx;
+static char warc_record_cdx_uuid[48];
+
+#ifdef ENABLE_WARC_THREADS
+/* Whether the record being written is collected in memory, to be
+   compressed in the background, and the memory.  */
+static bool warc_record_buffered;
+static char *warc_record_buf;
+static size_t warc_record_len, warc_record_alloc;
+#endif
+
 /* The current CDX file (or NULL, if CDX is disabled). */
 static FILE *warc_current_cdx_file;
 
@@ -114,6 +152,8 @@ static int warc_current_file_number;
 static struct hash_table * warc_cdx_dedup_table;
 
 static bool warc_start_new_file (bool meta);
+static FILE *warc_tempfile_open (void);
+static void warc_write_cdx_line (const char *, off_t, const char *);
 
 
 struct warc_cdx_record
@@ -146,6 +186,23 @@ warc_cmp_sha1_digest (const void *digest1, const void *digest2)
 static size_t
 warc_write_buffer (const char *buffer, size_t size)
 {
+#ifdef ENABLE_WARC_THREADS
+  if (warc_record_buffered)
+    {
+      if (warc_record_len + size > warc_record_alloc)
+        {
+          size_t alloc = warc_record_alloc ? warc_record_alloc : 16384;
+          while (alloc < warc_record_len + size)
+            alloc *= 2;
+          warc_record_buf = xrealloc (warc_record_buf, alloc);
+          warc_record_alloc = alloc;
+        }
+      memcpy (warc_record_buf + warc_record_len, buffer, size);
+      warc_record_len += size;
+      warc_current_gzfile_uncompressed_size += size;
+      return size;
+    }
+#endif
 #ifdef HAVE_LIBZ
   if (warc_current_gzfile)
     {
@@ -181,12 +238,403 @@ warc_write_string (const char *str)
 #define FLG_FEXTRA          0x04
 #define OFF_FLG             3
 
+#ifdef HAVE_LIBZ
+/* Fills EXTRA_HEADER with the extra field of a gzip member: the skip
+   length field, holding the length of the member in the WARC file and
+   the length of the record in it.  */
+static void
+warc_gzip_extra_header (char *extra_header, off_t member_size,
+                        off_t record_size)
+{
+  /* XLEN, the length of the extra header fields.  */
+  extra_header[0]  = ((EXTRA_GZIP_HEADER_SIZE - 2) & 255);
+  extra_header[1]  = ((EXTRA_GZIP_HEADER_SIZE - 2) >> 8) & 255;
+  /* The extra header field identifier for the WARC skip length. */
+  extra_header[2]  = 's';
+  extra_header[3]  = 'l';
+  /* The size of the field value (8 bytes).  */
+  extra_header[4]  = (8 & 255);
+  extra_header[5]  = ((8 >> 8) & 255);
+  /* The size of the member.  */
+  extra_header[6]  = (member_size & 255);
+  extra_header[7]  = (member_size >> 8) & 255;
+  extra_header[8]  = (member_size >> 16) & 255;
+  extra_header[9]  = (member_size >> 24) & 255;
+  /* The size of the record.  */
+  extra_header[10] = (record_size & 255);
+  extra_header[11] = (record_size >> 8) & 255;
+  extra_header[12] = (record_size >> 16) & 255;
+  extra_header[13] = (record_size >> 24) & 255;
+}
+
+/* Starts a new GZIP stream in the current WARC file for the record
+   being written.  */
+static bool
+warc_gzip_start (void)
+{
+  int dup_fd;
+  /* Record the starting offset of the new record. */
+  warc_current_gzfile_offset = ftello (warc_current_file);
+
+  /* Reserve space for the extra GZIP header field.
+     In warc_write_end_record we will fill this space
+     with information about the uncompressed and
+     compressed size of the record. */
+  if (fseek (warc_current_file, EXTRA_GZIP_HEADER_SIZE, SEEK_CUR) < 0)
+    {
+      logprintf (LOG_NOTQUIET, _("Error setting WARC file position.\n"));
+      warc_write_ok = false;
+      return false;
+    }
+
+  if (fflush (warc_current_file) != 0)
+    {
+      logprintf (LOG_NOTQUIET, _("Error flushing WARC file to disk.\n"));
+      warc_write_ok = false;
+      return false;
+    }
+
+  /* Start a new GZIP stream. */
+  dup_fd = dup (fileno (warc_current_file));
+  if (dup_fd < 0)
+    {
+      logprintf (LOG_NOTQUIET,
+_("Error duplicating WARC file file descriptor.\n"));
+      warc_write_ok = false;
+      return false;
+    }
+
+  warc_current_gzfile = gzdopen (dup_fd, "wb9");
+  warc_current_gzfile_uncompressed_size = 0;
+
+  if (warc_current_gzfile == NULL)
+    {
+      logprintf (LOG_NOTQUIET,
+_("Error opening GZIP stream to WARC file.\n"));
+      close (dup_fd);
+      warc_write_ok = false;
+      return false;
+    }
+  return true;
+}
+#endif /* HAVE_LIBZ */
+
+#ifdef ENABLE_WARC_THREADS
+
+/* Background compression.  With --warc-compression-threads=N, each
+   record is collected in memory instead of going through gzwrite.  N
+   threads deflate the records into gzip members, extra field
+   included, and one more thread appends the members to the WARC file
+   in the order of the records, writing their CDX lines as it learns
+   their offsets.  A record too large to be kept in memory is
+   compressed on the spot as before, once the records queued ahead of
+   it are in the file.  */
+
+/* Records larger than this are compressed on the spot. */
+#define WARC_JOB_MAX_SIZE (4 * 1024 * 1024)
+
+/* The queued records don't take more memory than this, unless a
+   single one does.  */
+#define WARC_QUEUE_MAX_SIZE (32 * 1024 * 1024)
+
+struct warc_job {
+  char *data;                   /* the record, then the gzip member */
+  size_t size;                  /* the length of DATA */
+  size_t record_size;           /* the length of the record */
+  char *cdx;                    /* see warc_record_cdx */
+  char cdx_uuid[48];
+  bool done;                    /* whether DATA holds the member */
+  bool failed;                  /* whether compression failed */
+  struct warc_job *next;        /* the next record in the queue */
+};
+
+/* WARC_QUEUE_LOCK protects all the variables below. */
+static pthread_mutex_t warc_queue_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Signaled when a record is queued, compressed, and written. */
+static pthread_cond_t warc_job_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t warc_job_deflated = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t warc_job_written = PTHREAD_COND_INITIALIZER;
+
+/* The records not written yet, in order, and the first of them that
+   no thread has started to compress.  */
+static struct warc_job *warc_queue_head, *warc_queue_tail, *warc_queue_next;
+
+/* The total length of the records not written yet. */
+static size_t warc_queue_size;
+
+/* The length of the WARC file as far as the writer thread knows. */
+static off_t warc_queue_file_size;
+
+/* Set when a record could not be compressed or written. */
+static bool warc_queue_failed;
+
+/* Set when the threads are to finish. */
+static bool warc_queue_stop;
+
+/* The threads started: the writer, then the compressing ones. */
+static pthread_t *warc_threads;
+static int warc_thread_count;
+
+/* Compresses the record in JOB into a gzip member, in the form
+   warc_write_end_record gives it in the file.  */
+static bool
+warc_deflate_job (struct warc_job *job)
+{
+  z_stream zs;
+  char *member;
+  uLong bound;
+
+  memset (&zs, 0, sizeof (zs));
+  /* The parameters gzdopen uses for "wb9". */
+  if (deflateInit2 (&zs, 9, Z_DEFLATED, MAX_WBITS + 16, 8,
+                    Z_DEFAULT_STRATEGY) != Z_OK)
+    return false;
+  bound = deflateBound (&zs, job->size);
+
+  /* Not xmalloc, which would exit from this thread. */
+  member = malloc (EXTRA_GZIP_HEADER_SIZE + bound);
+  if (member == NULL)
+    {
+      deflateEnd (&zs);
+      return false;
+    }
+
+  zs.next_in = (Bytef *) job->data;
+  zs.avail_in = job->size;
+  zs.next_out = (Bytef *) member + EXTRA_GZIP_HEADER_SIZE;
+  zs.avail_out = bound;
+  if (deflate (&zs, Z_FINISH) != Z_STREAM_END)
+    {
+      deflateEnd (&zs);
+      free (member);
+      return false;
+    }
+  deflateEnd (&zs);
+
+  /* Move the static header in front of the extra field. */
+  memmove (member, member + EXTRA_GZIP_HEADER_SIZE, GZIP_STATIC_HEADER_SIZE);
+  member[OFF_FLG] |= FLG_FEXTRA;
+  warc_gzip_extra_header (member + GZIP_STATIC_HEADER_SIZE,
+                          EXTRA_GZIP_HEADER_SIZE + zs.total_out, job->size);
+
+  free (job->data);
+  job->data = member;
+  job->size = EXTRA_GZIP_HEADER_SIZE + zs.total_out;
+  return true;
+}
+
+static void *
+warc_deflate_thread (void *arg _GL_UNUSED)
+{
+  pthread_mutex_lock (&warc_queue_lock);
+  for (;;)
+    {
+      struct warc_job *job;
+      bool ok;
+
+      while (!warc_queue_next && !warc_queue_stop)
+        pthread_cond_wait (&warc_job_queued, &warc_queue_lock);
+      if (!warc_queue_next)
+        break;
+      job = warc_queue_next;
+      warc_queue_next = job->next;
+      pthread_mutex_unlock (&warc_queue_lock);
+
+      ok = warc_deflate_job (job);
+
+      pthread_mutex_lock (&warc_queue_lock);
+      job->failed = !ok;
+      job->done = true;
+      pthread_cond_signal (&warc_job_deflated);
+    }
+  pthread_mutex_unlock (&warc_queue_lock);
+  return NULL;
+}
+
+static void *
+warc_writer_thread (void *arg _GL_UNUSED)
+{
+  pthread_mutex_lock (&warc_queue_lock);
+  for (;;)
+    {
+      struct warc_job *job = warc_queue_head;
+      off_t offset = -1;
+      bool ok;
+
+      if (!job || !job->done)
+        {
+          if (!job && warc_queue_stop)
+            break;
+          pthread_cond_wait (&warc_job_deflated, &warc_queue_lock);
+          continue;
+        }
+      ok = !warc_queue_failed && !job->failed;
+      pthread_mutex_unlock (&warc_queue_lock);
+
+      /* While records are queued, only this thread uses the WARC and
+         CDX files.  */
+      if (ok)
+        {
+          offset = ftello (warc_current_file);
+          ok = (offset >= 0
+                && fwrite (job->data, 1, job->size,
+                           warc_current_file) == job->size);
+          if (ok && job->cdx)
+            warc_write_cdx_line (job->cdx, offset, job->cdx_uuid);
+        }
+
+      pthread_mutex_lock (&warc_queue_lock);
+      if (ok)
+        warc_queue_file_size = offset + job->size;
+      else
+        warc_queue_failed = true;
+      warc_queue_head = job->next;
+      if (!warc_queue_head)
+        warc_queue_tail = NULL;
+      warc_queue_size -= job->record_size;
+      pthread_cond_broadcast (&warc_job_written);
+      free (job->data);
+      free (job->cdx);
+      free (job);
+    }
+  pthread_mutex_unlock (&warc_queue_lock);
+  return NULL;
+}
+
+/* Waits until the queued records are in the WARC file. */
+static void
+warc_queue_drain (void)
+{
+  if (!warc_thread_count)
+    return;
+  pthread_mutex_lock (&warc_queue_lock);
+  while (warc_queue_head)
+    pthread_cond_wait (&warc_job_written, &warc_queue_lock);
+  if (warc_queue_failed)
+    warc_write_ok = false;
+  pthread_mutex_unlock (&warc_queue_lock);
+}
+
+/* Queues the record collected in memory, waiting for room if the
+   queue is full.  */
+static void
+warc_queue_record (void)
+{
+  struct warc_job *job = xnew0 (struct warc_job);
+
+  job->data = warc_record_buf;
+  job->size = job->record_size = warc_record_len;
+  job->cdx = warc_record_cdx;
+  memcpy (job->cdx_uuid, warc_record_cdx_uuid, sizeof (job->cdx_uuid));
+  warc_record_buf = NULL;
+  warc_record_len = warc_record_alloc = 0;
+  warc_record_cdx = NULL;
+
+  pthread_mutex_lock (&warc_queue_lock);
+  while (warc_queue_head
+         && warc_queue_size + job->record_size > WARC_QUEUE_MAX_SIZE)
+    pthread_cond_wait (&warc_job_written, &warc_queue_lock);
+  if (warc_queue_tail)
+    warc_queue_tail->next = job;
+  else
+    warc_queue_head = job;
+  warc_queue_tail = job;
+  if (!warc_queue_next)
+    warc_queue_next = job;
+  warc_queue_size += job->record_size;
+  if (warc_queue_failed)
+    warc_write_ok = false;
+  pthread_cond_signal (&warc_job_queued);
+  pthread_mutex_unlock (&warc_queue_lock);
+}
+
+/* Compresses the record being collected on the spot instead, once the
+   records queued before it are in the WARC file.  */
+static void
+warc_unbuffer_record (void)
+{
+  char *buf = warc_record_buf;
+  size_t len = warc_record_len;
+
+  warc_record_buffered = false;
+  warc_record_buf = NULL;
+  warc_record_len = warc_record_alloc = 0;
+
+  warc_queue_drain ();
+  if (warc_write_ok && warc_gzip_start ())
+    {
+      warc_current_record_offset = warc_current_gzfile_offset;
+      if (warc_write_buffer (buf, len) != len)
+        warc_write_ok = false;
+    }
+  xfree (buf);
+}
+
+/* Writes the queued records and stops the threads. */
+static void
+warc_threads_stop (void)
+{
+  int i;
+
+  if (!warc_threads)
+    return;
+  warc_queue_drain ();
+  pthread_mutex_lock (&warc_queue_lock);
+  warc_queue_stop = true;
+  pthread_cond_broadcast (&warc_job_queued);
+  pthread_cond_broadcast (&warc_job_deflated);
+  pthread_mutex_unlock (&warc_queue_lock);
+  for (i = 0; i < warc_thread_count; i++)
+    pthread_join (warc_threads[i], NULL);
+  xfree (warc_threads);
+  warc_thread_count = 0;
+  warc_queue_stop = false;
+}
+
+/* Starts the writer thread and opt.warc_compression_threads threads
+   to compress the records.  */
+static void
+warc_threads_start (void)
+{
+  int count = opt.warc_compression_threads + 1;
+  sigset_t all, old;
+
+  warc_threads = xnew_array (pthread_t, count);
+
+  /* Block all signals in the threads: SIGALRM in particular must reach
+     the main thread.  */
+  sigfillset (&all);
+  pthread_sigmask (SIG_SETMASK, &all, &old);
+  while (warc_thread_count < count
+         && pthread_create (&warc_threads[warc_thread_count], NULL,
+                            warc_thread_count
+                            ? warc_deflate_thread : warc_writer_thread,
+                            NULL) == 0)
+    ++warc_thread_count;
+  pthread_sigmask (SIG_SETMASK, &old, NULL);
+
+  /* Without a thread to compress them, no record would be written. */
+  if (warc_thread_count < 2)
+    {
+      warc_threads_stop ();
+      return;
+    }
+
+  /* Don't lose the queued records if the program exits without
+     calling warc_close.  */
+  atexit (warc_threads_stop);
+}
+
+#endif /* ENABLE_WARC_THREADS */
+
 /* Starts a new WARC record.  Writes the version header.
    If opt.warc_maxsize is set and the current file is becoming
    too large, this will open a new WARC file.
 
    If compression is enabled, this will start a new
-   gzip stream in the current WARC file.
+   gzip stream in the current WARC file, or collect the
+   record in memory to be compressed in the background.
 
    Returns false and set warc_write_ok to false if there
    is an error.  */
@@ -196,60 +644,41 @@ warc_write_start_record (void)
   if (!warc_write_ok)
     return false;
 
-  fflush (warc_current_file);
-  if (opt.warc_maxsize > 0 && ftello (warc_current_file) >= opt.warc_maxsize)
-    warc_start_new_file (false);
-
-#ifdef HAVE_LIBZ
-  /* Start a GZIP stream, if required. */
-  if (opt.warc_compression_enabled)
+#ifdef ENABLE_WARC_THREADS
+  if (warc_thread_count)
     {
-      int dup_fd;
-      /* Record the starting offset of the new record. */
-      warc_current_gzfile_offset = ftello (warc_current_file);
-
-      /* Reserve space for the extra GZIP header field.
-         In warc_write_end_record we will fill this space
-         with information about the uncompressed and
-         compressed size of the record. */
-      if (fseek (warc_current_file, EXTRA_GZIP_HEADER_SIZE, SEEK_CUR) < 0)
-        {
-          logprintf (LOG_NOTQUIET, _("Error setting WARC file position.\n"));
-          warc_write_ok = false;
-          return false;
-        }
-
-      if (fflush (warc_current_file) != 0)
-        {
-          logprintf (LOG_NOTQUIET, _("Error flushing WARC file to disk.\n"));
-          warc_write_ok = false;
-          return false;
-        }
-
-      /* Start a new GZIP stream. */
-      dup_fd = dup (fileno (warc_current_file));
-      if (dup_fd < 0)
+      /* The writer thread has the WARC file; go by what it knows. */
+      off_t size;
+
+      pthread_mutex_lock (&warc_queue_lock);
+      size = warc_queue_file_size;
+      pthread_mutex_unlock (&warc_queue_lock);
+      if (opt.warc_maxsize > 0 && size >= opt.warc_maxsize
+          && !warc_start_new_file (false))
         {
-          logprintf (LOG_NOTQUIET,
-_("Error duplicating WARC file file descriptor.\n"));
           warc_write_ok = false;
           return false;
         }
 
-      warc_current_gzfile = gzdopen (dup_fd, "wb9");
+      warc_record_buffered = true;
+      warc_record_len = 0;
       warc_current_gzfile_uncompressed_size = 0;
-
-      if (warc_current_gzfile == NULL)
-        {
-          logprintf (LOG_NOTQUIET,
-_("Error opening GZIP stream to WARC file.\n"));
-          close (dup_fd);
-          warc_write_ok = false;
-          return false;
-        }
+      warc_write_string ("WARC/1.0\r\n");
+      return warc_write_ok;
     }
 #endif
 
+  fflush (warc_current_file);
+  if (opt.warc_maxsize > 0 && ftello (warc_current_file) >= opt.warc_maxsize)
+    warc_start_new_file (false);
+  warc_current_record_offset = ftello (warc_current_file);
+
+#ifdef HAVE_LIBZ
+  /* Start a GZIP stream, if required. */
+  if (opt.warc_compression_enabled && !warc_gzip_start ())
+    return false;
+#endif
+
   warc_write_string ("WARC/1.0\r\n");
   return warc_write_ok;
 }
@@ -286,6 +715,8 @@ warc_write_header_uri (const char *name, const char *value)
   return warc_write_ok;
 }
 
+#define WARC_COPY_BUFSIZE (64 * 1024)
+
 /* Copies the contents of DATA_IN to the WARC record.
    Adds a Content-Length header to the WARC record.
    Run this method after warc_write_header,
@@ -295,25 +726,57 @@ warc_write_block_from_file (FILE *data_in)
 {
   /* Add the Content-Length header. */
   char content_length[MAX_INT_TO_STRING_LEN(off_t)];
-  char buffer[BUFSIZ];
+  char *buffer;
+  off_t length, copied = 0;
   size_t s;
 
   fseeko (data_in, 0L, SEEK_END);
-  number_to_string (content_length, ftello (data_in));
+  length = ftello (data_in);
+  number_to_string (content_length, length);
   warc_write_header ("Content-Length", content_length);
 
   /* End of the WARC header section. */
   warc_write_string ("\r\n");
 
-  if (fseeko (data_in, 0L, SEEK_SET) != 0)
+#ifdef ENABLE_WARC_THREADS
+  /* Don't keep large records in memory. */
+  if (warc_record_buffered && warc_record_len + length > WARC_JOB_MAX_SIZE)
+    warc_unbuffer_record ();
+#endif
+
+#ifdef HAVE_COPY_FILE_RANGE
+  /* Without compression, let the kernel copy large blocks.  */
+  if (warc_write_ok && length >= WARC_COPY_BUFSIZE
+      && !opt.warc_compression_enabled
+      && fflush (warc_current_file) == 0)
+    {
+      off_t out_off = ftello (warc_current_file);
+
+      while (out_off >= 0 && copied < length)
+        {
+          ssize_t n = copy_file_range (fileno (data_in), &copied,
+                                       fileno (warc_current_file), &out_off,
+                                       length - copied, 0);
+          if (n <= 0)
+            break;
+        }
+      if (out_off < 0 || fseeko (warc_current_file, out_off, SEEK_SET) != 0)
+        warc_write_ok = false;
+    }
+#endif
+
+  if (fseeko (data_in, copied, SEEK_SET) != 0)
     warc_write_ok = false;
 
-  /* Copy the data in the file to the WARC record. */
-  while (warc_write_ok && (s = fread (buffer, 1, BUFSIZ, data_in)) > 0)
+  /* Copy the rest of the data in the file to the WARC record. */
+  buffer = xmalloc (WARC_COPY_BUFSIZE);
+  while (warc_write_ok
+         && (s = fread (buffer, 1, WARC_COPY_BUFSIZE, data_in)) > 0)
     {
       if (warc_write_buffer (buffer, s) < s)
         warc_write_ok = false;
     }
+  xfree (buffer);
 
   return warc_write_ok;
 }
@@ -323,7 +786,11 @@ warc_write_block_from_file (FILE *data_in)
    If compression is enabled, this method closes the
    current GZIP stream and fills the extra GZIP header
    with the uncompressed and compressed length of the
-   record. */
+   record, or queues the record to be compressed in the
+   background.
+
+   The CDX line of the record, if any, is written once
+   the record is in the WARC file. */
 static bool
 warc_write_end_record (void)
 {
@@ -333,6 +800,15 @@ warc_write_end_record (void)
       return false;
     }
 
+#ifdef ENABLE_WARC_THREADS
+  if (warc_record_buffered)
+    {
+      warc_record_buffered = false;
+      warc_queue_record ();
+      return warc_write_ok;
+    }
+#endif
+
 #ifdef HAVE_LIBZ
   /* We start a new gzip stream for each record.  */
   if (warc_write_ok && warc_current_gzfile)
@@ -398,25 +874,8 @@ warc_write_end_record (void)
       fwrite (static_header, 1, GZIP_STATIC_HEADER_SIZE, warc_current_file);
 
       /* Prepare the extra GZIP header. */
-      /* XLEN, the length of the extra header fields.  */
-      extra_header[0]  = ((EXTRA_GZIP_HEADER_SIZE - 2) & 255);
-      extra_header[1]  = ((EXTRA_GZIP_HEADER_SIZE - 2) >> 8) & 255;
-      /* The extra header field identifier for the WARC skip length. */
-      extra_header[2]  = 's';
-      extra_header[3]  = 'l';
-      /* The size of the field value (8 bytes).  */
-      extra_header[4]  = (8 & 255);
-      extra_header[5]  = ((8 >> 8) & 255);
-      /* The size of the uncompressed record.  */
-      extra_header[6]  = (uncompressed_size & 255);
-      extra_header[7]  = (uncompressed_size >> 8) & 255;
-      extra_header[8]  = (uncompressed_size >> 16) & 255;
-      extra_header[9]  = (uncompressed_size >> 24) & 255;
-      /* The size of the compressed record.  */
-      extra_header[10] = (compressed_size & 255);
-      extra_header[11] = (compressed_size >> 8) & 255;
-      extra_header[12] = (compressed_size >> 16) & 255;
-      extra_header[13] = (compressed_size >> 24) & 255;
+      warc_gzip_extra_header (extra_header, uncompressed_size,
+                              compressed_size);
 
       /* Write the extra header after the static header. */
       fseeko (warc_current_file, warc_current_gzfile_offset
@@ -429,6 +888,11 @@ warc_write_end_record (void)
     }
 #endif /* HAVE_LIBZ */
 
+  if (warc_write_ok && warc_record_cdx)
+    warc_write_cdx_line (warc_record_cdx, warc_current_record_offset,
+                         warc_record_cdx_uuid);
+  xfree (warc_record_cdx);
+
   return warc_write_ok;
 }
 
@@ -582,6 +1046,33 @@ warc_sha1_stream_with_payload (FILE *stream, void *res_block, void *res_payload,
 #undef BLOCKSIZE
 }
 
+/* Computes the digests of FILE like warc_sha1_stream_with_payload.
+   If FILE was written through warc_tempfile_write, with the payload
+   starting at PAYLOAD_OFFSET, they are already known.  */
+static int
+warc_tempfile_digests (FILE *file, void *res_block, void *res_payload,
+                       off_t payload_offset)
+{
+  if (file == warc_tmp_digest.file)
+    {
+      warc_tmp_digest.file = NULL;
+      if (fseeko (file, 0L, SEEK_END) == 0
+          && ftello (file) == warc_tmp_digest.size
+          && (payload_offset < 0
+              || payload_offset == warc_tmp_digest.payload_offset))
+        {
+          sha1_finish_ctx (&warc_tmp_digest.block, res_block);
+          if (payload_offset >= 0)
+            sha1_finish_ctx (&warc_tmp_digest.payload, res_payload);
+          return 0;
+        }
+    }
+
+  rewind (file);
+  return warc_sha1_stream_with_payload (file, res_block, res_payload,
+                                        payload_offset);
+}
+
 /* Converts the SHA1 digest to a base32-encoded string.
    "sha1:DIGEST\0"  (Allocates a new string for the response.)  */
 static char *
@@ -613,8 +1104,7 @@ warc_write_digest_headers (FILE *file, long payload_offset)
       char sha1_res_block[SHA1_DIGEST_SIZE];
       char sha1_res_payload[SHA1_DIGEST_SIZE];
 
-      rewind (file);
-      if (warc_sha1_stream_with_payload (file, sha1_res_block,
+      if (warc_tempfile_digests (file, sha1_res_block,
           sha1_res_payload, payload_offset) == 0)
         {
           char digest[BASE32_LENGTH(SHA1_DIGEST_SIZE) + 1 + 5];
@@ -865,6 +1355,10 @@ warc_start_new_file (bool meta)
   if (opt.warc_filename == NULL)
     return false;
 
+#ifdef ENABLE_WARC_THREADS
+  /* Write the queued records to the file they belong to. */
+  warc_queue_drain ();
+#endif
   if (warc_current_file != NULL)
     fclose (warc_current_file);
 
@@ -900,6 +1394,11 @@ warc_start_new_file (bool meta)
                  quote (new_filename));
       return false;
     }
+#ifdef ENABLE_WARC_THREADS
+  pthread_mutex_lock (&warc_queue_lock);
+  warc_queue_file_size = 0;
+  pthread_mutex_unlock (&warc_queue_lock);
+#endif
 
   if (! warc_write_warcinfo_record (new_filename))
     return false;
@@ -1194,6 +1693,11 @@ warc_init (void)
           log_set_warc_log_fp (warc_log_fp);
         }
 
+#ifdef ENABLE_WARC_THREADS
+      if (opt.warc_compression_enabled && opt.warc_compression_threads > 0)
+        warc_threads_start ();
+#endif
+
       warc_current_file_number = -1;
       if (! warc_start_new_file (false))
         {
@@ -1269,6 +1773,9 @@ warc_close (void)
   if (warc_current_file != NULL)
     {
       warc_write_metadata ();
+#ifdef ENABLE_WARC_THREADS
+      warc_threads_stop ();
+#endif
       *warc_current_warcinfo_uuid_str = 0;
       fclose (warc_current_file);
       warc_current_file = NULL;
@@ -1292,6 +1799,55 @@ warc_close (void)
    Returns the pointer to the temporary file, or NULL. */
 FILE *
 warc_tempfile (void)
+{
+  FILE *fp = warc_tempfile_open ();
+
+  /* Digest what is written to the file through warc_tempfile_write.  */
+  warc_tmp_digest.file = opt.warc_digests_enabled ? fp : NULL;
+  warc_tmp_digest.size = 0;
+  warc_tmp_digest.payload_offset = -1;
+  sha1_init_ctx (&warc_tmp_digest.block);
+  return fp;
+}
+
+/* Writes SIZE bytes from BUF to FP, a file opened by warc_tempfile,
+   like fwrite.  The bytes are digested on the way if FP is the last
+   file opened.  */
+size_t
+warc_tempfile_write (FILE *fp, const void *buf, size_t size)
+{
+  size_t written = fwrite (buf, 1, size, fp);
+
+  if (fp == warc_tmp_digest.file)
+    {
+      if (written != size)
+        {
+          /* Leave the digests to be computed from the file.  */
+          warc_tmp_digest.file = NULL;
+          return written;
+        }
+      sha1_process_bytes (buf, size, &warc_tmp_digest.block);
+      if (warc_tmp_digest.payload_offset >= 0)
+        sha1_process_bytes (buf, size, &warc_tmp_digest.payload);
+      warc_tmp_digest.size += size;
+    }
+  return written;
+}
+
+/* Notes that the bytes written to FP from now on are the payload of
+   the record.  */
+void
+warc_tempfile_payload_start (FILE *fp)
+{
+  if (fp == warc_tmp_digest.file && warc_tmp_digest.payload_offset < 0)
+    {
+      warc_tmp_digest.payload_offset = warc_tmp_digest.size;
+      sha1_init_ctx (&warc_tmp_digest.payload);
+    }
+}
+
+static FILE *
+warc_tempfile_open (void)
 {
   char filename[100];
   int fd;
@@ -1361,30 +1917,26 @@ warc_write_request_record (const char *url, const char *timestamp_str,
   return warc_write_ok;
 }
 
-/* Writes a response record to the CDX file.
+/* Returns the start of the CDX line of a response record, up to its
+   offset in the WARC file.
    url  is the target uri of the request/response,
    timestamp_str  is the timestamp of the request that generated this response,
                   (generated with warc_timestamp),
    mime_type  is the mime type of the response body (will be printed to CDX),
    response_code  is the HTTP response code (will be printed to CDX),
    payload_digest  is the sha1 digest of the payload,
-   redirect_location  is the contents of the Location: header, or NULL (will be printed to CDX),
-   offset  is the position of the WARC record in the WARC file,
-   warc_filename  is the filename of the WARC,
-   response_uuid  is the uuid of the response.
-   Returns true on success, false on error. */
-static bool
-warc_write_cdx_record (const char *url, const char *timestamp_str,
-                       const char *mime_type, int response_code,
-                       const char *payload_digest, const char *redirect_location,
-                       off_t offset, const char *warc_filename _GL_UNUSED,
-                       const char *response_uuid)
+   redirect_location  is the contents of the Location: header, or NULL (will be printed to CDX).
+   The caller frees the result. */
+static char *
+warc_cdx_line_start (const char *url, const char *timestamp_str,
+                     const char *mime_type, int response_code,
+                     const char *payload_digest, const char *redirect_location)
 {
   /* Transform the timestamp. */
   char timestamp_str_cdx[15];
-  char offset_string[MAX_INT_TO_STRING_LEN(off_t)];
   const char *checksum;
   char *tmp_location = NULL;
+  char *line;
 
   memcpy (timestamp_str_cdx     , timestamp_str     , 4); /* "YYYY" "-" */
   memcpy (timestamp_str_cdx +  4, timestamp_str +  5, 2); /* "mm"   "-" */
@@ -1407,17 +1959,29 @@ warc_write_cdx_record (const char *url, const char *timestamp_str,
   else
     tmp_location = url_escape(redirect_location);
 
+  line = aprintf ("%s %s %s %s %d %s %s - ", url, timestamp_str_cdx, url,
+                  mime_type, response_code, checksum, tmp_location);
+  free (tmp_location);
+
+  return line;
+}
+
+/* Writes a response record to the CDX file.
+   line_start  is the start of the line, from warc_cdx_line_start,
+   offset  is the position of the WARC record in the WARC file,
+   response_uuid  is the uuid of the response.  */
+static void
+warc_write_cdx_line (const char *line_start, off_t offset,
+                     const char *response_uuid)
+{
+  char offset_string[MAX_INT_TO_STRING_LEN(off_t)];
+
   number_to_string (offset_string, offset);
 
   /* Print the CDX line. */
-  fprintf (warc_current_cdx_file, "%s %s %s %s %d %s %s - %s %s %s\n", url,
-           timestamp_str_cdx, url, mime_type, response_code, checksum,
-           tmp_location, offset_string, warc_current_filename,
-           response_uuid);
+  fprintf (warc_current_cdx_file, "%s%s %s %s\n", line_start, offset_string,
+           warc_current_filename, response_uuid);
   fflush (warc_current_cdx_file);
-  free (tmp_location);
-
-  return true;
 }
 
 /* Writes a revisit record to the WARC file.
@@ -1444,6 +2008,7 @@ warc_write_revisit_record (const char *url, const char *timestamp_str,
 
   warc_uuid_str (revisit_uuid, sizeof (revisit_uuid));
 
+  rewind (body);
   sha1_stream (body, sha1_res_block);
   warc_base32_sha1_digest (sha1_res_block, block_digest, sizeof(block_digest));
 
@@ -1488,18 +2053,17 @@ warc_write_response_record (const char *url, const char *timestamp_str,
                             FILE *body, off_t payload_offset, const char *mime_type,
                             int response_code, const char *redirect_location)
 {
-  char block_digest[BASE32_LENGTH(SHA1_DIGEST_SIZE) + 1 + 5];
-  char payload_digest[BASE32_LENGTH(SHA1_DIGEST_SIZE) + 1 + 5];
+  char block_digest_buf[BASE32_LENGTH(SHA1_DIGEST_SIZE) + 1 + 5];
+  char payload_digest_buf[BASE32_LENGTH(SHA1_DIGEST_SIZE) + 1 + 5];
+  char *block_digest = NULL, *payload_digest = NULL;
   char sha1_res_block[SHA1_DIGEST_SIZE];
   char sha1_res_payload[SHA1_DIGEST_SIZE];
   char response_uuid [48];
-  off_t offset;
 
   if (opt.warc_digests_enabled)
     {
       /* Calculate the block and payload digests. */
-      rewind (body);
-      if (warc_sha1_stream_with_payload (body, sha1_res_block, sha1_res_payload,
+      if (warc_tempfile_digests (body, sha1_res_block, sha1_res_payload,
           payload_offset) == 0)
         {
           /* Decide (based on url + payload digest) if we have seen this
@@ -1514,24 +2078,30 @@ warc_write_response_record (const char *url, const char *timestamp_str,
               logprintf (LOG_VERBOSE,
           _("Found exact match in CDX file. Saving revisit record to WARC.\n"));
 
-              /* Remove the payload from the file. */
+              /* Remove the payload from the file.  Flush the stream
+                 first, so that nothing it has buffered outlives the
+                 payload.  */
               if (payload_offset > 0)
                 {
-                  if (ftruncate (fileno (body), payload_offset) == -1)
+                  if (fflush (body) != 0
+                      || ftruncate (fileno (body), payload_offset) == -1)
                     return false;
                 }
 
               /* Send the original payload digest. */
-              warc_base32_sha1_digest (sha1_res_payload, payload_digest, sizeof(payload_digest));
+              warc_base32_sha1_digest (sha1_res_payload, payload_digest_buf,
+                                       sizeof(payload_digest_buf));
               result = warc_write_revisit_record (url, timestamp_str,
-                         concurrent_to_uuid, payload_digest, rec_existing->uuid,
-                         ip, body);
+                         concurrent_to_uuid, payload_digest_buf,
+                         rec_existing->uuid, ip, body);
 
               return result;
             }
 
-          warc_base32_sha1_digest (sha1_res_block, block_digest, sizeof(block_digest));
-          warc_base32_sha1_digest (sha1_res_payload, payload_digest, sizeof(payload_digest));
+          block_digest = warc_base32_sha1_digest (sha1_res_block,
+                           block_digest_buf, sizeof(block_digest_buf));
+          payload_digest = warc_base32_sha1_digest (sha1_res_payload,
+                             payload_digest_buf, sizeof(payload_digest_buf));
         }
     }
 
@@ -1539,9 +2109,6 @@ warc_write_response_record (const char *url, const char *timestamp_str,
 
   warc_uuid_str (response_uuid, sizeof (response_uuid));
 
-  fseeko (warc_current_file, 0L, SEEK_END);
-  offset = ftello (warc_current_file);
-
   warc_write_start_record ();
   warc_write_header ("WARC-Type", "response");
   warc_write_header ("WARC-Record-ID", response_uuid);
@@ -1554,17 +2121,19 @@ warc_write_response_record (const char *url, const char *timestamp_str,
   warc_write_header ("WARC-Payload-Digest", payload_digest);
   warc_write_header ("Content-Type", "application/http;msgtype=response");
   warc_write_block_from_file (body);
-  warc_write_end_record ();
-
-  fclose (body);
-
   if (warc_write_ok && opt.warc_cdx_enabled)
     {
-      /* Add this record to the CDX. */
-      warc_write_cdx_record (url, timestamp_str, mime_type, response_code,
-      payload_digest, redirect_location, offset, warc_current_filename,
-      response_uuid);
+      /* Add this record to the CDX once it is in the WARC file. */
+      warc_record_cdx = warc_cdx_line_start (url, timestamp_str, mime_type,
+                                             response_code, payload_digest,
+                                             redirect_location);
+      snprintf (warc_record_cdx_uuid, sizeof (warc_record_cdx_uuid), "%s",
+                response_uuid);
     }
+  warc_write_end_record ();
+  xfree (warc_record_cdx);
+
+  fclose (body);
 
   return warc_write_ok;
 }
@@ -11,6 +11,8 @@ void warc_uuid_str (char *id_str, size_t urn_size);
 char * warc_timestamp (char *timestamp, size_t timestamp_size);
 
 FILE * warc_tempfile (void);
+size_t warc_tempfile_write (FILE *fp, const void *buf, size_t size);
+void warc_tempfile_payload_start (FILE *fp);
 
 bool warc_write_request_record (const char *url, const char *timestamp_str,
   const char *concurrent_to_uuid, const ip_address *ip, FILE *body, off_t payload_offset);
@@ -0,0 +1,519 @@
+/* Pool of worker processes.
+   Copyright (C) 2021 Free Software Foundation, Inc.
+
+This file is part of GNU Wget.
+
+GNU Wget is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 3 of the License, or
+ (at your option) any later version.
+
+GNU Wget is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Wget.  If not, see <http://www.gnu.org/licenses/>.
+
+Additional permission under GNU GPL version 3 section 7
+
+If you modify this program, or any covered work, by linking or
+combining it with the OpenSSL project's OpenSSL library (or a
+modified version of that library), containing parts covered by the
+terms of the OpenSSL or SSLeay licenses, the Free Software Foundation
+grants you additional permission to convey the resulting work.
+Corresponding Source for a non-source form of such a combination
+shall include the source code for the parts of OpenSSL used as well
+as that of the covered work.  */
+
+/* This file implements a small pool of worker processes that run
+   jobs on behalf of the main process.  Wget keeps a lot of global
+   state (options, the cookie jar, the log, the download registry in
+   convert.c) that is not safe to share between threads, so instead
+   of threads we fork copies of the process.  Each worker inherits the
+   state of the main process at the time the pool was created, runs
+   one job at a time and sends the results back over a pipe.  The
+   main process is responsible for merging whatever the results
+   describe into its own state.
+
+   The entry points are:
+
+     worker_pool_new     -- fork a pool of workers running a function.
+     worker_pool_submit  -- hand a job to an idle worker.
+     worker_pool_collect -- get the results of a finished job.
+     worker_pool_delete  -- terminate the workers.
+
+   Jobs and results are passed as `struct wmsg' messages, which are
+   simply sequences of numbers and strings.  */
+
+#include "wget.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <signal.h>
+#ifdef HAVE_SYS_WAIT_H
+# include <sys/wait.h>
+#endif
+
+#include "utils.h"
+#include "connect.h"
+#include "exits.h"
+#include "workers.h"
+
+/* Functions for building and parsing messages.  */
+
+void
+msg_init (struct wmsg *msg)
+{
+  xzero (*msg);
+}
+
+/* Empty MSG, but keep its storage for reuse. */
+
+void
+msg_reset (struct wmsg *msg)
+{
+  msg->size = 0;
+  msg->pos = 0;
+}
+
+void
+msg_free (struct wmsg *msg)
+{
+  xfree (msg->data);
+  msg_init (msg);
+}
+
+static void
+msg_reserve (struct wmsg *msg, size_t len)
+{
+  if (msg->size + len > msg->allocated)
+    {
+      msg->allocated = MAX (msg->allocated * 2, msg->size + len);
+      msg->allocated = MAX (msg->allocated, 256);
+      msg->data = xrealloc (msg->data, msg->allocated);
+    }
+}
+
+void
+msg_put_bytes (struct wmsg *msg, const char *bytes, size_t len)
+{
+  msg_reserve (msg, len);
+  memcpy (msg->data + msg->size, bytes, len);
+  msg->size += len;
+}
+
+void
+msg_put_number (struct wmsg *msg, wgint number)
+{
+  msg_put_bytes (msg, (const char *) &number, sizeof (number));
+}
+
+void
+msg_put_double (struct wmsg *msg, double number)
+{
+  msg_put_bytes (msg, (const char *) &number, sizeof (number));
+}
+
+/* Append string S to MSG.  S may be NULL, in which case
+   msg_get_string will return NULL.  */
+
+void
+msg_put_string (struct wmsg *msg, const char *s)
+{
+  if (!s)
+    {
+      msg_put_number (msg, -1);
+      return;
+    }
+  msg_put_number (msg, strlen (s));
+  msg_put_bytes (msg, s, strlen (s));
+}
+
+/* Copy the next LEN bytes of MSG to DEST.  Return false (and zero
+   DEST) if MSG is exhausted, which only happens if the peer sent a
+   truncated or malformed message.  */
+
+static bool
+msg_get_bytes (struct wmsg *msg, void *dest, size_t len)
+{
+  if (msg->size - msg->pos < len)
+    {
+      memset (dest, 0, len);
+      msg->pos = msg->size;
+      return false;
+    }
+  memcpy (dest, msg->data + msg->pos, len);
+  msg->pos += len;
+  return true;
+}
+
+wgint
+msg_get_number (struct wmsg *msg)
+{
+  wgint number;
+  msg_get_bytes (msg, &number, sizeof (number));
+  return number;
+}
+
+double
+msg_get_double (struct wmsg *msg)
+{
+  double number;
+  msg_get_bytes (msg, &number, sizeof (number));
+  return number;
+}
+
+/* Return a freshly allocated copy of the next string in MSG, or NULL
+   if the string was stored as NULL.  */
+
+char *
+msg_get_string (struct wmsg *msg)
+{
+  wgint len = msg_get_number (msg);
+  char *s;
+
+  if (len < 0 || (size_t) len > msg->size - msg->pos)
+    return NULL;
+  s = xmalloc (len + 1);
+  msg_get_bytes (msg, s, len);
+  s[len] = '\0';
+  return s;
+}
+
+/* Reading and writing messages over pipes.  On the wire, a message
+   is preceded by its length.  */
+
+static bool
+write_all (int fd, const char *buf, size_t len)
+{
+  while (len > 0)
+    {
+      ssize_t res = write (fd, buf, len);
+      if (res < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          return false;
+        }
+      buf += res;
+      len -= res;
+    }
+  return true;
+}
+
+static bool
+read_all (int fd, char *buf, size_t len)
+{
+  while (len > 0)
+    {
+      ssize_t res = read (fd, buf, len);
+      if (res < 0 && errno == EINTR)
+        continue;
+      if (res <= 0)
+        return false;
+      buf += res;
+      len -= res;
+    }
+  return true;
+}
+
+static bool
+msg_send (int fd, const struct wmsg *msg)
+{
+  size_t len = msg->size;
+  return write_all (fd, (const char *) &len, sizeof (len))
+    && write_all (fd, msg->data, len);
+}
+
+static bool
+msg_receive (int fd, struct wmsg *msg)
+{
+  size_t len;
+
+  msg_reset (msg);
+  if (!read_all (fd, (char *) &len, sizeof (len)))
+    return false;
+  msg_reserve (msg, len);
+  if (!read_all (fd, msg->data, len))
+    return false;
+  msg->size = len;
+  return true;
+}
+
+/* The pool. */
+
+struct worker {
+  pid_t pid;
+  int job_fd;                   /* write end of the job pipe */
+  int reply_fd;                 /* read end of the reply pipe */
+  int job;                      /* id of the job being run, or -1
+                                   if the worker is idle */
+};
+
+struct worker_pool {
+  struct worker workers[MAX_WORKERS];
+  int count;                    /* number of live workers */
+  int busy;                     /* number of workers running a job */
+  int next_job;                 /* id of the next submitted job */
+  struct fd_loop *loop;         /* waits for the reply pipes */
+  int ready_fd;                 /* reply pipe found readable by LOOP */
+};
+
+/* The main loop of a worker process: read jobs from IN_FD, run them
+   through FN and write the results to OUT_FD, until the main process
+   closes the job pipe.  */
+
+static void
+worker_main (int in_fd, int out_fd, worker_fn_t fn)
+{
+  struct wmsg job, reply;
+
+  msg_init (&job);
+  msg_init (&reply);
+
+  while (msg_receive (in_fd, &job))
+    {
+      msg_reset (&reply);
+      fn (&job, &reply);
+      if (!msg_send (out_fd, &reply))
+        break;
+    }
+
+  /* Don't run the atexit handlers: they would save cookies, HSTS
+     data and such on behalf of the main process.  */
+  fflush (NULL);
+  _exit (WGET_EXIT_SUCCESS);
+}
+
+/* Remove the worker at position W from POOL, after it has exited or
+   the pipes to it have failed.  */
+
+static void
+worker_remove (struct worker_pool *pool, int w)
+{
+  struct worker *wk = &pool->workers[w];
+
+  fd_loop_remove (pool->loop, wk->reply_fd);
+  close (wk->job_fd);
+  close (wk->reply_fd);
+  waitpid (wk->pid, NULL, 0);
+  if (wk->job >= 0)
+    --pool->busy;
+  pool->workers[w] = pool->workers[--pool->count];
+}
+
+/* Called by the pool's event loop when the reply pipe FD has
+   something to read.  */
+
+static void
+worker_reply_ready (int fd, int events _GL_UNUSED, void *arg)
+{
+  struct worker_pool *pool = arg;
+  if (pool->ready_fd < 0)
+    pool->ready_fd = fd;
+}
+
+/* Fork COUNT worker processes which will run jobs through FN.  The
+   workers start out with a copy of the current state of the program.
+   Returns NULL if no worker could be started, in which case the
+   caller is expected to do the work itself.  */
+
+struct worker_pool *
+worker_pool_new (int count, worker_fn_t fn)
+{
+#if defined(WINDOWS) || defined(MSDOS) || defined(__VMS)
+  (void) count;
+  (void) fn;
+  return NULL;
+#else
+  struct worker_pool *pool = xnew0 (struct worker_pool);
+  int i;
+
+  if (count > MAX_WORKERS)
+    count = MAX_WORKERS;
+
+  pool->loop = fd_loop_new ();
+
+  /* Don't let the workers inherit (and later flush again) output
+     that is still buffered.  */
+  fflush (NULL);
+
+  for (i = 0; i < count; i++)
+    {
+      int job_pipe[2], reply_pipe[2];
+      pid_t pid;
+
+      if (pipe (job_pipe) < 0)
+        break;
+      if (pipe (reply_pipe) < 0)
+        {
+          close (job_pipe[0]);
+          close (job_pipe[1]);
+          break;
+        }
+
+      pid = fork ();
+      if (pid < 0)
+        {
+          close (job_pipe[0]);
+          close (job_pipe[1]);
+          close (reply_pipe[0]);
+          close (reply_pipe[1]);
+          break;
+        }
+      if (pid == 0)
+        {
+          int j;
+          /* Drop the ends of the pipes belonging to the other workers
+             so that they see EOF when the main process closes them. */
+          for (j = 0; j < pool->count; j++)
+            {
+              close (pool->workers[j].job_fd);
+              close (pool->workers[j].reply_fd);
+            }
+          close (job_pipe[1]);
+          close (reply_pipe[0]);
+          worker_main (job_pipe[0], reply_pipe[1], fn);
+        }
+
+      close (job_pipe[0]);
+      close (reply_pipe[1]);
+      fd_loop_add (pool->loop, reply_pipe[0], WAIT_FOR_READ,
+                   worker_reply_ready, pool);
+      pool->workers[pool->count].pid = pid;
+      pool->workers[pool->count].job_fd = job_pipe[1];
+      pool->workers[pool->count].reply_fd = reply_pipe[0];
+      pool->workers[pool->count].job = -1;
+      ++pool->count;
+    }
+
+  if (!pool->count)
+    {
+      logprintf (LOG_NOTQUIET, _("Cannot start worker processes: %s\n"),
+                 strerror (errno));
+      fd_loop_delete (pool->loop);
+      xfree (pool);
+      return NULL;
+    }
+  DEBUGP (("Started %d worker processes.\n", pool->count));
+  return pool;
+#endif
+}
+
+/* Hand JOB to an idle worker in POOL.  Returns the id of the job, to
+   be matched against the value worker_pool_collect returns, or -1 if
+   all the workers are busy.  */
+
+int
+worker_pool_submit (struct worker_pool *pool, struct wmsg *job)
+{
+  int w;
+
+  for (w = 0; w < pool->count; w++)
+    {
+      struct worker *wk = &pool->workers[w];
+      if (wk->job >= 0)
+        continue;
+      if (!msg_send (wk->job_fd, job))
+        {
+          /* The worker is gone; forget about it and try the next. */
+          worker_remove (pool, w--);
+          continue;
+        }
+      wk->job = pool->next_job++;
+      ++pool->busy;
+      return wk->job;
+    }
+  return -1;
+}
+
+/* Store the results of a finished job in REPLY and return its id.  If
+   BLOCK is true, wait for a busy worker to finish; otherwise, return
+   -1 if none has finished yet.  -1 is also returned if no worker is
+   busy.
+
+   If the worker running the job has died, its id is returned with an
+   empty REPLY.  */
+
+int
+worker_pool_collect (struct worker_pool *pool, bool block, struct wmsg *reply)
+{
+  while (pool->busy)
+    {
+      int w;
+
+      /* The loop is level-triggered: pipes that are readable but not
+         handled this time are reported again on the next round.  */
+      pool->ready_fd = -1;
+      if (fd_loop_run (pool->loop, block ? -1 : 0) <= 0)
+        return -1;
+
+      for (w = 0; w < pool->count; w++)
+        {
+          struct worker *wk = &pool->workers[w];
+          int job = wk->job;
+
+          if (wk->reply_fd != pool->ready_fd)
+            continue;
+          if (job < 0)
+            {
+              /* An idle worker has nothing to say; it has died.  */
+              worker_remove (pool, w);
+              break;
+            }
+          if (!msg_receive (wk->reply_fd, reply))
+            {
+              logprintf (LOG_NOTQUIET, _("Worker process %d died.\n"),
+                         (int) wk->pid);
+              msg_reset (reply);
+              worker_remove (pool, w);
+              return job;
+            }
+          wk->job = -1;
+          --pool->busy;
+          return job;
+        }
+    }
+  return -1;
+}
+
+/* Return the number of workers currently running a job. */
+
+int
+worker_pool_busy (const struct worker_pool *pool)
+{
+  return pool->busy;
+}
+
+/* Return the number of live workers in POOL. */
+
+int
+worker_pool_size (const struct worker_pool *pool)
+{
+  return pool->count;
+}
+
+/* Terminate the workers of POOL and free it.  Jobs still running are
+   allowed to finish, but their results are discarded.  */
+
+void
+worker_pool_delete (struct worker_pool *pool)
+{
+  int w;
+
+  for (w = 0; w < pool->count; w++)
+    close (pool->workers[w].job_fd);
+  for (w = 0; w < pool->count; w++)
+    {
+      fd_loop_remove (pool->loop, pool->workers[w].reply_fd);
+      close (pool->workers[w].reply_fd);
+      waitpid (pool->workers[w].pid, NULL, 0);
+    }
+  fd_loop_delete (pool->loop);
+  xfree (pool);
+}
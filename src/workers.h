@@ -0,0 +1,74 @@
+/* Declarations for workers.c.
+   Copyright (C) 2021 Free Software Foundation, Inc.
+
+This file is part of GNU Wget.
+
+GNU Wget is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 3 of the License, or
+ (at your option) any later version.
+
+GNU Wget is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Wget.  If not, see <http://www.gnu.org/licenses/>.
+
+Additional permission under GNU GPL version 3 section 7
+
+If you modify this program, or any covered work, by linking or
+combining it with the OpenSSL project's OpenSSL library (or a
+modified version of that library), containing parts covered by the
+terms of the OpenSSL or SSLeay licenses, the Free Software Foundation
+grants you additional permission to convey the resulting work.
+Corresponding Source for a non-source form of such a combination
+shall include the source code for the parts of OpenSSL used as well
+as that of the covered work.  */
+
+#ifndef WORKERS_H
+#define WORKERS_H
+
+/* The maximum number of worker processes in a pool. */
+#define MAX_WORKERS 64
+
+/* A message exchanged between the main process and a worker.  Values
+   are appended with the msg_put_* functions and read back, in the
+   same order, with the msg_get_* functions.  */
+struct wmsg {
+  char *data;                   /* contents of the message */
+  size_t size;                  /* number of bytes used in DATA */
+  size_t allocated;             /* number of bytes allocated for DATA */
+  size_t pos;                   /* read position */
+};
+
+void msg_init (struct wmsg *);
+void msg_reset (struct wmsg *);
+void msg_free (struct wmsg *);
+
+void msg_put_number (struct wmsg *, wgint);
+void msg_put_double (struct wmsg *, double);
+void msg_put_string (struct wmsg *, const char *);
+void msg_put_bytes (struct wmsg *, const char *, size_t);
+
+wgint msg_get_number (struct wmsg *);
+double msg_get_double (struct wmsg *);
+char *msg_get_string (struct wmsg *);
+
+struct worker_pool;             /* forward declaration; all struct
+                                   members are private */
+
+/* The function a worker runs for each job: it reads its arguments
+   from the first message and stores the results in the second.  */
+typedef void (*worker_fn_t) (struct wmsg *, struct wmsg *);
+
+struct worker_pool *worker_pool_new (int, worker_fn_t);
+void worker_pool_delete (struct worker_pool *);
+
+int worker_pool_submit (struct worker_pool *, struct wmsg *);
+int worker_pool_collect (struct worker_pool *, bool, struct wmsg *);
+int worker_pool_busy (const struct worker_pool *);
+int worker_pool_size (const struct worker_pool *);
+
+#endif /* WORKERS_H */
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that --convert-early leaves the same files behind as
+    --convert-links alone.  The pages whose links all lead to files
+    already downloaded are converted while crawling, the others once the
+    crawl is done; links to downloaded files become relative, and links
+    to the others complete.
+"""
+############# File Definitions ###############################################
+mainpage = """
+<html>
+<head>
+  <link rel="stylesheet" href="b/style.css">
+</head>
+<body>
+  <a href="a/one.html">One</a>
+  <a href="/a/two.html">Two</a>
+  <a href="http://localhost:{{port}}/b/three.html">Three</a>
+  <a href="c/skip.html">Skipped</a>
+</body>
+</html>
+"""
+mainpage_converted = """
+<html>
+<head>
+  <link rel="stylesheet" href="b/style.css">
+</head>
+<body>
+  <a href="a/one.html">One</a>
+  <a href="a/two.html">Two</a>
+  <a href="b/three.html">Three</a>
+  <a href="http://localhost:{{port}}/c/skip.html">Skipped</a>
+</body>
+</html>
+"""
+
+onepage = """
+<html>
+<body>
+  <a href="../index.html">Home</a>
+  <a href="two.html#end">Two</a>
+  <img src="/b/pic.png">
+</body>
+</html>
+"""
+onepage_converted = """
+<html>
+<body>
+  <a href="../index.html">Home</a>
+  <a href="two.html#end">Two</a>
+  <img src="../b/pic.png">
+</body>
+</html>
+"""
+
+twopage = """
+<html>
+<body>
+  <a href="/index.html">Home</a>
+  <a href="../b/three.html">Three</a>
+  <a href="/c/skip.html">Skipped</a>
+</body>
+</html>
+"""
+twopage_converted = """
+<html>
+<body>
+  <a href="../index.html">Home</a>
+  <a href="../b/three.html">Three</a>
+  <a href="http://localhost:{{port}}/c/skip.html">Skipped</a>
+</body>
+</html>
+"""
+
+threepage = """
+<html>
+<body>
+  <a href="/index.html">Home</a>
+  <a href="../a/one.html">One</a>
+</body>
+</html>
+"""
+threepage_converted = """
+<html>
+<body>
+  <a href="../index.html">Home</a>
+  <a href="../a/one.html">One</a>
+</body>
+</html>
+"""
+
+stylesheet = """
+body { background: url("pic.png"); }
+div { background: url(/c/skip.png); }
+"""
+stylesheet_converted = """
+body { background: url("pic.png"); }
+div { background: url(http://localhost:{{port}}/c/skip.png); }
+"""
+
+css_rules = {
+    "SendHeader"        : {
+        "Content-Type"  : "text/css"
+    }
+}
+
+index_html = WgetFile ("index.html", mainpage)
+one_html = WgetFile ("a/one.html", onepage)
+two_html = WgetFile ("a/two.html", twopage)
+three_html = WgetFile ("b/three.html", threepage)
+style_css = WgetFile ("b/style.css", stylesheet, rules=css_rules)
+pic_png = WgetFile ("b/pic.png", "Not really a picture")
+skip_html = WgetFile ("c/skip.html", "Not downloaded")
+
+index_conv = WgetFile ("index.html", mainpage_converted)
+one_conv = WgetFile ("a/one.html", onepage_converted)
+two_conv = WgetFile ("a/two.html", twopage_converted)
+three_conv = WgetFile ("b/three.html", threepage_converted)
+style_conv = WgetFile ("b/style.css", stylesheet_converted)
+
+WGET_OPTIONS = "--recursive --no-host-directories --convert-links " \
+               "--exclude-directories=/c --convert-early"
+WGET_URLS = [["index.html"]]
+
+Files = [[index_html, one_html, two_html, three_html, style_css, pic_png,
+          skip_html]]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_conv, one_conv, two_conv, three_conv,
+                           style_conv, pic_png]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+).begin ()
+
+exit (err)
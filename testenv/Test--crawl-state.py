@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that a recursive download cut short by --quota can be
+    continued with --crawl-state: the second run downloads the files the
+    first one didn't get to, and removes the state file once it is done.
+"""
+############# File Definitions ###############################################
+mainpage = """
+<html>
+<body>
+  <a href="a/File1.html">One</a>
+  <a href="a/File2.html">Two</a>
+  <a href="b/File3.html">Three</a>
+</body>
+</html>
+"""
+File1 = """<html><body>
+<a href="../b/File4.txt">Four</a>
+</body></html>"""
+
+index_html = WgetFile ("index.html", mainpage)
+File1_File = WgetFile ("a/File1.html", File1)
+File2_File = WgetFile ("a/File2.html", "With lemon or cream?")
+File3_File = WgetFile ("b/File3.html", "Surely you're joking Mr. Feynman")
+File4_File = WgetFile ("b/File4.txt", "The last one")
+
+# The first run stops once it has downloaded more than the quota, which
+# the first page alone is.
+FIRST_OPTIONS = "--recursive --no-host-directories --crawl-state=crawl " \
+                "--quota=10"
+WGET_OPTIONS = "--recursive --no-host-directories --crawl-state=crawl"
+WGET_URLS = [["index.html"]]
+
+Files = [[index_html, File1_File, File2_File, File3_File, File4_File]]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_html, File1_File, File2_File, File3_File,
+                           File4_File]
+Request_List = [["GET /index.html",
+                 "GET /robots.txt",
+                 "GET /a/File1.html",
+                 "GET /a/File2.html",
+                 "GET /b/File3.html",
+                 "GET /b/File4.txt"]]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode,
+    "FilesCrawled"      : Request_List
+}
+
+http_test = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+)
+
+http_test.setup()
+### Run Wget a first time, leaving the state of the crawl behind.
+http_test.pre_hook_call()
+http_test.hook_call({"WgetCommands" : FIRST_OPTIONS, "Urls" : WGET_URLS},
+                    'Test Option')
+http_test.exec_wget()
+
+err = http_test.begin ()
+
+exit (err)
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that the lookups saved in the file given to
+    --dns-cache-file are used: the host name in the URL can't be resolved
+    otherwise.
+"""
+############# File Definitions ###############################################
+File1 = "Found it in the cache."
+
+cache = "# DNS cache for GNU Wget.\n" \
+        "# <hostname>\t<expires>\t<addresses>\n" \
+        "wget-test.invalid\t0\t127.0.0.1\n"
+
+A_File = WgetFile ("File1", File1)
+Cache_File = WgetFile ("dns-cache", cache)
+
+WGET_OPTIONS = "--dns-cache-file=dns-cache " \
+               "http://wget-test.invalid:{{port}}/File1"
+WGET_URLS = [[]]
+
+Files = [[A_File]]
+Existing_Files = [Cache_File]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [A_File, Cache_File]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files,
+    "LocalFiles"        : Existing_Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+).begin ()
+
+exit (err)
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that with --parallel, a file that an earlier link
+    was redirected to is not kept a second time under its own name, even
+    though a worker was given its URL before the redirection was known.
+"""
+############# File Definitions ###############################################
+mainpage = """
+<html>
+<body>
+  <a href="moved.html">Moved</a>
+  <a href="target.html">Target</a>
+</body>
+</html>
+"""
+
+moved_rules = {
+    "Response"          : 301,
+    "SendHeader"        : {"Location" : "/target.html"}
+}
+
+index_html = WgetFile ("index.html", mainpage)
+moved_html = WgetFile ("moved.html", "", rules=moved_rules)
+target_html = WgetFile ("target.html", "The target")
+moved_retrieved = WgetFile ("moved.html", "The target")
+
+WGET_OPTIONS = "--recursive --no-host-directories --parallel=3 " \
+               "--no-http-keep-alive"
+WGET_URLS = [["index.html"]]
+
+Files = [[index_html, moved_html, target_html]]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_html, moved_retrieved]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+).begin ()
+
+exit (err)
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that a recursive download with --parallel retrieves
+    every linked file once, and saves each one under its own name.
+"""
+############# File Definitions ###############################################
+mainpage = """
+<html>
+<head>
+  <title>Main Page</title>
+</head>
+<body>
+  <a href="a/one.html">One</a>
+  <a href="a/two.html">Two</a>
+  <a href="b/three.txt">Three</a>
+  <img src="b/four.png">
+</body>
+</html>
+"""
+
+onepage = """
+<html>
+<body>
+  <a href="../b/five.txt">Five</a>
+  <a href="two.html">Two</a>
+</body>
+</html>
+"""
+
+twopage = """
+<html>
+<body>
+  <a href="../index.html">Back</a>
+  <a href="six.txt">Six</a>
+</body>
+</html>
+"""
+
+index_html = WgetFile ("index.html", mainpage)
+one_html = WgetFile ("a/one.html", onepage)
+two_html = WgetFile ("a/two.html", twopage)
+three_txt = WgetFile ("b/three.txt", "Third file")
+four_png = WgetFile ("b/four.png", "Not really a picture")
+five_txt = WgetFile ("b/five.txt", "Fifth file")
+six_txt = WgetFile ("a/six.txt", "Sixth file")
+
+WGET_OPTIONS = "--recursive --no-host-directories --parallel=3 " \
+               "--no-http-keep-alive"
+WGET_URLS = [["index.html"]]
+
+Files = [[index_html, one_html, two_html, three_txt, four_png, five_txt,
+          six_txt]]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_html, one_html, two_html, three_txt,
+                           four_png, five_txt, six_txt]
+Request_List = [["GET /index.html",
+                 "GET /robots.txt",
+                 "GET /a/one.html",
+                 "GET /a/two.html",
+                 "GET /b/three.txt",
+                 "GET /b/four.png",
+                 "GET /b/five.txt",
+                 "GET /a/six.txt"]]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode,
+    "FilesCrawled"      : Request_List
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+).begin ()
+
+exit (err)
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that a recursive download whose queue outgrows
+    --queue-memory, and is thus partly written to temporary files, still
+    retrieves every page and every file they link to.
+"""
+############# File Definitions ###############################################
+Pages = 12
+
+mainpage = "<html><body>\n" + \
+    "".join ('<a href="p%d.html">Page %d</a>\n' % (i, i)
+             for i in range (Pages)) + \
+    "</body></html>\n"
+
+def page (i):
+    return "<html><body>\n" + \
+        "".join ('<a href="leaf%d-%d.txt">Leaf %d</a>\n' % (i, j, j)
+                 for j in range (2)) + \
+        "</body></html>\n"
+
+index_html = WgetFile ("index.html", mainpage)
+Page_Files = [WgetFile ("p%d.html" % i, page (i)) for i in range (Pages)]
+Leaf_Files = [WgetFile ("leaf%d-%d.txt" % (i, j), "Leaf %d of page %d" % (j, i))
+              for i in range (Pages) for j in range (2)]
+
+WGET_OPTIONS = "--recursive --no-host-directories --queue-memory=2"
+WGET_URLS = [["index.html"]]
+
+Files = [[index_html] + Page_Files + Leaf_Files]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_html] + Page_Files + Leaf_Files
+Request_List = [["GET /index.html", "GET /robots.txt"] +
+                ["GET /" + f.name for f in Page_Files + Leaf_Files]]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode,
+    "FilesCrawled"      : Request_List
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+).begin ()
+
+exit (err)
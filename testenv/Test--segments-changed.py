@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that with --segments and -c, an earlier download
+    is not continued once the file has changed on the server, as told
+    by its ETag, but started over.  (It is downloaded again over a
+    single connection, which is all the test server can serve.)
+"""
+############# File Definitions ###############################################
+Contents = "".join ("%07d\n" % i for i in range (300000))
+Missing = 1024 * 1024
+
+File_rules = {
+    "SendHeader"        : {
+        "Accept-Ranges" : "bytes",
+        "ETag"          : "\"v1\""
+    }
+}
+
+Remote_File = WgetFile ("bigfile", Contents, rules=File_rules)
+Partial_File = WgetFile ("bigfile", "x" * Missing +
+                         "-" * (len (Contents) - Missing))
+State_File = WgetFile ("bigfile.wget-segments", "")
+
+WGET_OPTIONS = "--continue --segments=1"
+WGET_URLS = [["bigfile"]]
+
+Files = [[Remote_File]]
+Existing_Files = [Partial_File, State_File]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [Remote_File]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files,
+    "LocalFiles"        : Existing_Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode
+}
+
+http_test = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+)
+
+http_test.setup()
+### The state file names the URL, and thus the port of the server.
+State_File.content = "http://localhost:%s/bigfile\n%d\n\"v0\"\n%d %d\n" % \
+    (http_test.port, len (Contents), Missing, len (Contents))
+
+err = http_test.begin ()
+
+exit (err)
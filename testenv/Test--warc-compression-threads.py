@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+import os
+from subprocess import check_output
+from sys import exit
+from test.http_test import HTTPTest
+from test.base_test import SKIP_TEST
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that with --warc-compression-threads, the WARC file
+    holds every record in the order they were written, each in its own
+    GZIP member, and that the CDX file points at them.  One file is large
+    enough to be compressed on the spot, after the records queued ahead of
+    it.
+"""
+# The option only exists in builds with zlib.
+wget_path = os.getenv("WGET_PATH", os.path.join("..", "src", "wget"))
+if "--warc-compression-threads" not in check_output ([wget_path, "--help"],
+                                                     universal_newlines=True):
+    exit (SKIP_TEST)
+
+############# File Definitions ###############################################
+mainpage = """
+<html>
+<body>
+  <a href="a/one.html">One</a>
+  <a href="a/big.txt">Big</a>
+  <a href="b/two.txt">Two</a>
+</body>
+</html>
+"""
+
+onepage = """
+<html>
+<body>
+  <a href="../b/three.txt">Three</a>
+</body>
+</html>
+"""
+
+index_html = WgetFile ("index.html", mainpage)
+one_html = WgetFile ("a/one.html", onepage)
+big_txt = WgetFile ("a/big.txt", "".join ("%07d\n" % i
+                                          for i in range (600000)))
+two_txt = WgetFile ("b/two.txt", "Second file")
+three_txt = WgetFile ("b/three.txt", "Third file")
+
+WGET_OPTIONS = "--recursive --no-host-directories --warc-file=archive " \
+               "--warc-cdx --warc-compression-threads=2"
+WGET_URLS = [["index.html"]]
+
+Files = [[index_html, one_html, big_txt, two_txt, three_txt]]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_html, one_html, big_txt, two_txt, three_txt]
+ExpectedWarcFile = {
+    "File"              : "archive",
+    "Responses"         : ["http://localhost:{{port}}/index.html",
+                           "http://localhost:{{port}}/robots.txt",
+                           "http://localhost:{{port}}/a/one.html",
+                           "http://localhost:{{port}}/a/big.txt",
+                           "http://localhost:{{port}}/b/two.txt",
+                           "http://localhost:{{port}}/b/three.txt"]
+}
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedWarc"      : ExpectedWarcFile,
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+).begin ()
+
+exit (err)
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from test.base_test import HTTP
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that Wget can go back and forth between two servers
+    with persistent connections, keeping the connection to each one open
+    while it talks to the other.
+"""
+############# File Definitions ###############################################
+mainpage = """
+<html>
+<body>
+  <a href="http://localhost:{{port}}/b1.txt">B1</a>
+  <a href="a1.txt">A1</a>
+  <a href="http://localhost:{{port}}/b2.txt">B2</a>
+  <a href="a2.txt">A2</a>
+</body>
+</html>
+"""
+
+index_html = WgetFile ("index.html", mainpage)
+a1_txt = WgetFile ("a1.txt", "First file on the first server")
+a2_txt = WgetFile ("a2.txt", "Second file on the first server")
+b1_txt = WgetFile ("b1.txt", "First file on the second server")
+b2_txt = WgetFile ("b2.txt", "Second file on the second server")
+
+WGET_OPTIONS = "--recursive --span-hosts --no-directories"
+WGET_URLS = [["index.html"], []]
+
+Servers = [HTTP, HTTP]
+
+Files = [[index_html, a1_txt, a2_txt], [b1_txt, b2_txt]]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_html, a1_txt, a2_txt, b1_txt, b2_txt]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test,
+                protocols=Servers
+).begin ()
+
+exit (err)
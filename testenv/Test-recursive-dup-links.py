@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that a recursive download recognizes the URLs it has
+    already seen however the links to them are written, and retrieves
+    each file once.
+"""
+############# File Definitions ###############################################
+mainpage = """
+<html>
+<body>
+  <a href="a/b.html">B</a>
+  <a href="./a/b.html">B again</a>
+  <a href="a/../a/b.html">B once more</a>
+  <a href="a/b.html#top">Top of B</a>
+  <a href="http://localhost:{{port}}/a/b.html">B in full</a>
+  <a href="a/c.html">C</a>
+</body>
+</html>
+"""
+
+bpage = """
+<html>
+<body>
+  <a href="../index.html">Home</a>
+  <a href="/">Home again</a>
+  <a href="c.html">C</a>
+  <a href="/a/c.html">C again</a>
+</body>
+</html>
+"""
+
+cpage = """
+<html>
+<body>
+  <a href="b.html">B</a>
+  <a href="../a/b.html">B again</a>
+</body>
+</html>
+"""
+
+index_html = WgetFile ("index.html", mainpage)
+b_html = WgetFile ("a/b.html", bpage)
+c_html = WgetFile ("a/c.html", cpage)
+
+WGET_OPTIONS = "--recursive --no-host-directories"
+WGET_URLS = [["index.html"]]
+
+Files = [[index_html, b_html, c_html]]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_html, b_html, c_html]
+Request_List = [["GET /index.html",
+                 "GET /robots.txt",
+                 "GET /a/b.html",
+                 "GET /a/c.html",
+                 "GET /"]]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode,
+    "FilesCrawled"      : Request_List
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+).begin ()
+
+exit (err)
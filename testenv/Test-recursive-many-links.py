@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+from sys import exit
+from test.http_test import HTTPTest
+from misc.wget_file import WgetFile
+
+"""
+    This test ensures that a recursive download tells the URLs it has seen
+    from new ones even once it has seen many of them.  The thousands of
+    links that robots.txt forbids are never requested, but are added to
+    the set of URLs already seen, and make the filter --bloom-filter puts
+    in front of it grow.  The files linked to after them must all be downloaded.
+"""
+############# File Definitions ###############################################
+Forbidden = 3500
+Allowed = 100
+
+def page (prefix, count):
+    return "".join ('<a href="%s%d.txt">%d</a>\n' % (prefix, i, i)
+                    for i in range (count))
+
+robots = "User-agent: *\nDisallow: /no/\n"
+
+index_html = WgetFile ("index.html", "<html><body>\n" +
+                       page ("no/f", Forbidden) +
+                       '<a href="again.html">Again</a>\n' +
+                       "</body></html>\n")
+again_html = WgetFile ("again.html", "<html><body>\n" +
+                       page ("no/f", Forbidden) + page ("g", Allowed) +
+                       "</body></html>\n")
+robots_txt = WgetFile ("robots.txt", robots)
+Allowed_Files = [WgetFile ("g%d.txt" % i, str (i)) for i in range (Allowed)]
+
+WGET_OPTIONS = "--recursive --no-host-directories --bloom-filter"
+WGET_URLS = [["index.html"]]
+
+Files = [[index_html, again_html, robots_txt] + Allowed_Files]
+
+ExpectedReturnCode = 0
+ExpectedDownloadedFiles = [index_html, again_html, robots_txt] + Allowed_Files
+Request_List = [["GET /index.html", "GET /robots.txt", "GET /again.html"] +
+                ["GET /" + f.name for f in Allowed_Files]]
+
+################ Pre and Post Test Hooks #####################################
+pre_test = {
+    "ServerFiles"       : Files
+}
+test_options = {
+    "WgetCommands"      : WGET_OPTIONS,
+    "Urls"              : WGET_URLS
+}
+post_test = {
+    "ExpectedFiles"     : ExpectedDownloadedFiles,
+    "ExpectedRetcode"   : ExpectedReturnCode,
+    "FilesCrawled"      : Request_List
+}
+
+err = HTTPTest (
+                pre_hook=pre_test,
+                test_params=test_options,
+                post_hook=post_test
+).begin ()
+
+exit (err)
@@ -0,0 +1,89 @@
+import os
+import zlib
+from misc.colour_terminal import print_red
+from conf import hook
+from exc.test_failed import TestFailed
+
+""" Post-Test Hook: ExpectedWarc
+This is a post test hook that checks the WARC file written with --warc-file.
+It expects a dictionary with the name given to --warc-file under "File" and
+the ordered list of the URLs of the response records under "Responses". A
+compressed WARC file must hold one record in each GZIP member. If the CDX
+file exists, each of its lines must point at the record it names. The WARC
+and CDX files are removed once checked, so that ExpectedFiles only sees the
+files downloaded.
+"""
+
+
+@hook()
+class ExpectedWarc:
+    def __init__(self, expected_warc):
+        self.name = expected_warc['File']
+        self.responses = expected_warc['Responses']
+
+    @staticmethod
+    def split_record(data):
+        head, sep, rest = data.partition(b'\r\n\r\n')
+        if not head.startswith(b'WARC/') or not sep:
+            raise TestFailed('Malformed WARC record')
+        fields = {}
+        for line in head.split(b'\r\n')[1:]:
+            key, _, value = line.decode().partition(':')
+            fields[key] = value.strip()
+        length = int(fields['Content-Length'])
+        if rest[length:length + 4] != b'\r\n\r\n':
+            raise TestFailed('Malformed WARC record')
+        return fields, len(head) + 4 + length + 4
+
+    def read_records(self, data, compressed):
+        records = {}
+        offset = 0
+        while offset < len(data):
+            if compressed:
+                inflater = zlib.decompressobj(16 + zlib.MAX_WBITS)
+                record = inflater.decompress(data[offset:])
+                if not inflater.eof:
+                    raise TestFailed('Truncated GZIP member in WARC file')
+                fields, size = self.split_record(record)
+                if size != len(record):
+                    raise TestFailed('More than one record in a GZIP member')
+                size = len(data) - offset - len(inflater.unused_data)
+            else:
+                fields, size = self.split_record(data[offset:])
+            records[offset] = fields
+            offset += size
+        return records
+
+    def __call__(self, test_obj):
+        if os.path.exists(self.name + '.warc.gz'):
+            warc_name = self.name + '.warc.gz'
+        else:
+            warc_name = self.name + '.warc'
+        try:
+            with open(warc_name, 'rb') as fp:
+                data = fp.read()
+        except FileNotFoundError:
+            raise TestFailed('WARC file %s not found' % warc_name)
+        records = self.read_records(data, warc_name.endswith('.gz'))
+        os.remove(warc_name)
+
+        responses = [fields['WARC-Target-URI'].strip('<>')
+                     for offset, fields in sorted(records.items())
+                     if fields['WARC-Type'] == 'response']
+        expected = [test_obj._replace_substring(url)
+                    for url in self.responses]
+        if responses != expected:
+            print_red(str(responses))
+            raise TestFailed('WARC file does not hold the expected responses')
+
+        cdx_name = self.name + '.cdx'
+        if os.path.exists(cdx_name):
+            with open(cdx_name) as fp:
+                lines = fp.read().splitlines()[1:]
+            os.remove(cdx_name)
+            for line in lines:
+                fields = line.split(' ')
+                record = records.get(int(fields[-3]))
+                if not record or record['WARC-Record-ID'] != fields[-1]:
+                    print_red(line)
+                    raise TestFailed('CDX offset does not point at its record')
@@ -88,7 +88,8 @@ class _Handler(BaseHTTPRequestHandler):
             if start is None:
                 self.wfile.write(content.encode('utf-8'))
             else:
-                self.wfile.write(content.encode('utf-8')[start:])
+                self.wfile.write(content.encode('utf-8')
+                                 [start:self.range_end + 1])
 
     def do_POST(self):
         """ According to RFC 7231 sec 4.3.3, if the resource requested in a POST
@@ -145,10 +146,14 @@ class _Handler(BaseHTTPRequestHandler):
         if not header_line.startswith("bytes="):
             raise ServerError("Cannot parse header Range: %s" %
                               (header_line))
-        regex = re.match(r"^bytes=(\d*)\-$", header_line)
+        regex = re.match(r"^bytes=(\d*)\-(\d*)$", header_line)
         range_start = int(regex.group(1))
         if range_start >= length:
             raise ServerError("Range Overflow")
+        if regex.group(2):
+            self.range_end = min(int(regex.group(2)), length - 1)
+        else:
+            self.range_end = length - 1
         return range_start
 
     def get_body_data(self):
@@ -444,9 +449,9 @@ class _Handler(BaseHTTPRequestHandler):
                 self.add_header("Accept-Ranges", "bytes")
                 self.add_header("Content-Range",
                                 "bytes %d-%d/%d" % (self.range_begin,
-                                                    content_length - 1,
+                                                    self.range_end,
                                                     content_length))
-                content_length -= self.range_begin
+                content_length = self.range_end + 1 - self.range_begin
             cont_type = self.guess_type(path)
             self.add_header("Content-Type", cont_type)
             self.add_header("Content-Length", content_length)
@@ -39,7 +39,7 @@ class BaseTest:
         self.protocols = protocols
 
         if req_protocols is None:
-            self.req_protocols = map(lambda p: p.lower(), self.protocols)
+            self.req_protocols = [p.lower() for p in self.protocols]
         else:
             self.req_protocols = req_protocols
 
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+#
+# Time the download of a large body with various --read-buffer sizes.
+#
+# Usage: bench-read-buffer.py [WGET [MEGABYTES]]
+#
+# A local HTTP server sends MEGABYTES (default 200) of data, which
+# wget writes to /dev/null, so that the body goes through the read
+# buffer rather than being spliced to a file.  For each size, the
+# number of read calls made by wget (from /proc/PID/io, so Linux only),
+# its user and system CPU time and the wall time are printed, the best
+# of three runs.
+
+import os
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+WGET = sys.argv[1] if len(sys.argv) > 1 else \
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src",
+                 "wget")
+SIZE = (int(sys.argv[2]) if len(sys.argv) > 2 else 200) * 1024 * 1024
+BUFFERS = ["8k", "64k", "256k", "1m", "4m"]
+CHUNK = b"x" * (1024 * 1024)
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+
+    def do_GET(self):
+        self.send_response(200)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(SIZE))
+        self.end_headers()
+        left = SIZE
+        while left > 0:
+            n = min(left, len(CHUNK))
+            self.wfile.write(CHUNK[:n])
+            left -= n
+
+    def log_message(self, *args):
+        pass
+
+
+def run(url, read_buffer):
+    """Run wget once, returning its read calls, CPU time and wall time."""
+    args = [WGET, "-q", "-O", "/dev/null", "--no-config",
+            "--read-buffer=" + read_buffer, url]
+    start = time.monotonic()
+    pid = os.posix_spawn(WGET, args, os.environ)
+    # Wait for wget to exit, but read its I/O counters before reaping it.
+    os.waitid(os.P_PID, pid, os.WEXITED | os.WNOWAIT)
+    wall = time.monotonic() - start
+    with open("/proc/%d/io" % pid) as f:
+        io = dict(line.split(": ") for line in f.read().splitlines())
+    _, status, usage = os.wait4(pid, 0)
+    if status != 0:
+        sys.exit("%s failed with status %d" % (WGET, status))
+    return int(io["syscr"]), usage.ru_utime, usage.ru_stime, wall
+
+
+def main():
+    server = ThreadingHTTPServer(("127.0.0.1", 0), Handler)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    url = "http://127.0.0.1:%d/body" % server.server_address[1]
+
+    print("%d MB body" % (SIZE // (1024 * 1024)))
+    print("%-12s %10s %10s %10s %10s" % ("read-buffer", "reads", "user",
+                                         "system", "wall"))
+    for read_buffer in BUFFERS:
+        runs = [run(url, read_buffer) for _ in range(3)]
+        reads = min(r[0] for r in runs)
+        user, system, wall = min(runs, key=lambda r: r[3])[1:]
+        print("%-12s %10d %9.3fs %9.3fs %9.3fs" % (read_buffer, reads, user,
+                                                    system, wall))
+    server.shutdown()
+
+
+if __name__ == "__main__":
+    main()